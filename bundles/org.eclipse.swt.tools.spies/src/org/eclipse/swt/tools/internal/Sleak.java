@@ -21,6 +21,7 @@ import java.util.stream.*;
 import org.eclipse.swt.*;
 import org.eclipse.swt.custom.*;
 import org.eclipse.swt.graphics.*;
+import org.eclipse.swt.internal.LeakReport;
 import org.eclipse.swt.internal.WidgetSpy.*;
 import org.eclipse.swt.layout.*;
 import org.eclipse.swt.widgets.*;
@@ -36,7 +37,7 @@ import org.eclipse.swt.widgets.List;
 public class Sleak {
 	List list;
 	Canvas canvas;
-	Button enableTracking, diff, stackTrace, saveAs, save;
+	Button enableTracking, diff, stackTrace, saveAs, save, export;
 	Combo diffType;
 	Text text;
 
@@ -49,6 +50,7 @@ public class Sleak {
 
 	java.util.List<ObjectWithError> oldObjects = new ArrayList<> ();
 	java.util.List<ObjectWithError> objects = new ArrayList<> ();
+	LeakReport.Snapshot previousSnapshot, snapshot;
 
 	NonDisposedWidgetTracker nonDisposedWidgetTracker = new NonDisposedWidgetTracker();
 
@@ -126,7 +128,7 @@ public void create (Composite parent) {
 	enableTracking.setLayoutData(new GridData(SWT.NONE, SWT.NONE, false, false));
 
 	Composite buttons = new Composite(left, 0);
-	buttons.setLayout(new GridLayout(4, false));
+	buttons.setLayout(new GridLayout(5, false));
 	buttons.setLayoutData(new GridData(SWT.FILL, SWT.NONE, true, false));
 
 	diff = new Button (buttons, SWT.PUSH);
@@ -148,6 +150,12 @@ public void create (Composite parent) {
 	saveAs.addListener (SWT.Selection, event -> saveToFile (true));
 	saveAs.setLayoutData(new GridData(SWT.FILL, SWT.NONE, false, false));
 
+	export = new Button (buttons, SWT.PUSH);
+	export.setText ("Export Report...");
+	export.setToolTipText("Exports the resources created and disposed since the previous snap, grouped by type and allocation site, as JSON or CSV.");
+	export.addListener (SWT.Selection, event -> exportReport ());
+	export.setLayoutData(new GridData(SWT.FILL, SWT.NONE, false, false));
+
 	Composite checkboxAndCombo = new Composite(left, 0);
 	checkboxAndCombo.setLayout(new GridLayout(2, false));
 	checkboxAndCombo.setLayoutData(new GridData(SWT.FILL, SWT.NONE, true, false));
@@ -214,6 +222,8 @@ static void addCounts (StringBuilder string, String type, Long deleted, Long cre
 void refreshDifference () {
 	Display display = canvas.getDisplay();
 	DeviceData info = getDeviceData(display);
+	previousSnapshot = snapshot;
+	snapshot = LeakReport.Snapshot.capture(info);
 
 	boolean hasOldData = !oldObjects.isEmpty();
 
@@ -314,6 +324,8 @@ private DeviceData getDeviceData(Display display) {
 }
 
 boolean creatorEquals (StackTraceElement first, StackTraceElement second) {
+	// The creator is unknown for objects whose allocation stack was not sampled
+	if (first == null || second == null) return first == second;
 	switch (diffType.getSelectionIndex()) {
 		case 1: return first.equals(second);
 		case 2: return first.getClassName().equals(second.getClassName());
@@ -391,6 +403,33 @@ private void saveToFile(boolean prompt) {
 	}
 }
 
+private void exportReport() {
+	Display display = export.getDisplay();
+	if (snapshot == null) {
+		snapshot = LeakReport.Snapshot.capture(display);
+	}
+	LeakReport report = previousSnapshot == null ? LeakReport.of(snapshot) : LeakReport.between(previousSnapshot, snapshot);
+	FileDialog dialog = new FileDialog(export.getShell(), SWT.SAVE);
+	dialog.setFilterPath(filterPath);
+	dialog.setFileName(fileName + ".json");
+	dialog.setFilterExtensions(new String[] {"*.json", "*.csv"});
+	dialog.setFilterNames(new String[] {"JSON (*.json)", "CSV (*.csv)"});
+	dialog.setOverwrite(true);
+	String name = dialog.open();
+	if (name == null) {
+		return;
+	}
+	filterPath = dialog.getFilterPath();
+	try {
+		report.write(new File(name));
+	} catch (IOException e1) {
+		MessageBox msg = new MessageBox(export.getShell(), SWT.ICON_ERROR | SWT.OK);
+		msg.setText("Failed to export");
+		msg.setMessage("Failed to export S-Leak report.\n" + e1.getMessage());
+		msg.open();
+	}
+}
+
 void toggleStackTrace () {
 	refreshObject ();
 	canvas.getParent().layout ();
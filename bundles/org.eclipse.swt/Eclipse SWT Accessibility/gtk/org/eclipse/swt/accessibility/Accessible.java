@@ -1,5 +1,5 @@
 /*******************************************************************************
- * Copyright (c) 2000, 2016 IBM Corporation and others.
+ * Copyright (c) 2000, 2026 IBM Corporation and others.
  *
  * This program and the accompanying materials
  * are made available under the terms of the Eclipse Public License 2.0
@@ -63,6 +63,10 @@ public class Accessible {
 	Control control;
 	List<Relation> relations;
 	List<Accessible> children;
+	/* Incremented when the text of the control changes, see AccessibleObject.getText () */
+	int textGeneration;
+	/* Whether the control reports its text changes, only then is the text kept */
+	boolean textChangesReported;
 
 	static class Relation {
 		int type;
@@ -170,14 +174,24 @@ public class Accessible {
 	 *    <li>ERROR_THREAD_INVALID_ACCESS - if not called from the thread that created the receiver's control</li>
 	 * </ul>
 	 *
+	 * <p>
+	 * Once the control has reported a change of its text or value, with
+	 * <code>textChanged</code> or with <code>sendEvent</code> and
+	 * <code>ACC.EVENT_TEXT_CHANGED</code> or <code>ACC.EVENT_VALUE_CHANGED</code>,
+	 * the value answered by <code>getValue</code> may be kept until the next
+	 * such report. A control that reports one change must report all of them.
+	 * </p>
+	 *
 	 * @see AccessibleControlListener
 	 * @see #removeAccessibleControlListener
+	 * @see #textChanged
 	 */
 	public void addAccessibleControlListener (AccessibleControlListener listener) {
 		checkWidget ();
 		if (listener == null) SWT.error (SWT.ERROR_NULL_ARGUMENT);
 		if (accessibleControlListeners == null) accessibleControlListeners = new ArrayList<>();
 		accessibleControlListeners.add (listener);
+		textGeneration++;
 	}
 
 	/**
@@ -564,6 +578,20 @@ public class Accessible {
 		return control.getDisplay ().getThread () == Thread.currentThread ();
 	}
 
+	/*
+	* Discards the text kept by the accessible objects when an event reports
+	* that it changed, whether or not an object or child receives the event.
+	*/
+	void invalidateText (int event) {
+		switch (event) {
+			case ACC.EVENT_TEXT_CHANGED:
+			case ACC.EVENT_VALUE_CHANGED:
+				textGeneration++;
+				textChangesReported = true;
+				break;
+		}
+	}
+
 	void release () {
 		if (children != null) {
 			List<Accessible> temp = new ArrayList<>(children);
@@ -604,6 +632,7 @@ public class Accessible {
 			accessibleControlListeners.remove(listener);
 			if (accessibleControlListeners.isEmpty()) accessibleControlListeners = null;
 		}
+		textGeneration++;
 	}
 
 	/**
@@ -952,6 +981,7 @@ public class Accessible {
 	 */
 	public void sendEvent(int event, Object eventData) {
 		checkWidget();
+		invalidateText (event);
 		if (accessibleObject != null) {
 			accessibleObject.sendEvent(event, eventData);
 		}
@@ -987,6 +1017,7 @@ public class Accessible {
 	 */
 	public void sendEvent(int event, Object eventData, int childID) {
 		checkWidget();
+		invalidateText (event);
 		if (accessibleObject != null) {
 			switch (event) {
 				case ACC.EVENT_STATE_CHANGED:
@@ -1078,6 +1109,8 @@ public class Accessible {
 	 */
 	public void textChanged (int type, int startIndex, int length) {
 		checkWidget ();
+		textGeneration++;
+		textChangesReported = true;
 		if (accessibleObject != null) {
 			accessibleObject.textChanged (type, startIndex, length);
 		}
@@ -1,5 +1,5 @@
 /*******************************************************************************
- * Copyright (c) 2000, 2018 IBM Corporation and others.
+ * Copyright (c) 2000, 2026 IBM Corporation and others.
  *
  * This program and the accompanying materials
  * are made available under the terms of the Eclipse Public License 2.0
@@ -35,12 +35,28 @@ class AccessibleObject {
 	* to a logical child of a widget (eg.- a CTabItem, which is simply drawn)
 	*/
 	boolean isLightweight = false;
+	/*
+	* The text returned by getText (). It is reused until the text of the
+	* accessible changes or the character count of the parent text differs.
+	*/
+	String text;
+	long textParentCount;
+	int textGeneration = -1;
 
 	static long actionNamePtr = -1;
 	static long descriptionPtr = -1;
 	static long keybindingPtr = -1;
 	static long namePtr = -1;
 	static final Map<LONG, AccessibleObject> AccessibleObjects = new HashMap<> (9);
+	/*
+	* The last resolved object. An assistive technology usually issues
+	* several callbacks for the object it is visiting, which are answered
+	* without allocating a key.
+	*/
+	static long lastObjectHandle;
+	static AccessibleObject lastObject;
+	/* Lookup counters, see getObjectTableStatistics () */
+	static long lookupCount, lastObjectHits;
 	static final boolean DEBUG = Device.DEBUG;
 
 	AccessibleObject (long type, long widget, Accessible accessible, boolean isLightweight) {
@@ -67,7 +83,7 @@ class AccessibleObject {
 
 		this.accessible = accessible;
 		this.isLightweight = isLightweight;
-		AccessibleObjects.put (new LONG (atkHandle), this);
+		addObject (atkHandle, this);
 	}
 
 	static void print (String str) {
@@ -4426,7 +4442,7 @@ class AccessibleObject {
 	 * @return an AccessibleObject associated with the provided AtkObject pointer
 	 */
 	static AccessibleObject getAccessibleObject (long atkObject) {
-		AccessibleObject object = AccessibleObjects.get (new LONG (atkObject));
+		AccessibleObject object = findObject (atkObject);
 		if (object == null) return null;
 		if (object.accessible == null) return null;
 		Control control = object.accessible.control;
@@ -4451,20 +4467,33 @@ class AccessibleObject {
 		return null;
 	}
 
+	/*
+	* Returns the value of the object. Assistive technologies query the text
+	* one character, word or line at a time, so the value is kept until the
+	* text of the accessible changes, instead of fetching the whole parent
+	* text and running the getValue listeners for every query. The value is
+	* only kept for controls that report their text changes, the value of
+	* other controls may reflect model state that changes without notice.
+	*/
 	String getText () {
 		List<AccessibleControlListener> listeners = accessible.accessibleControlListeners;
 		int length = size(listeners);
 		if (length > 0) {
-			String parentText = "";	//$NON-NLS-1$
+			long characterCount = 0;
 			AtkTextIface iface = getParentTextIface (atkHandle);
 			if (iface != null && iface.get_character_count != 0) {
-				long characterCount = ATK.call (iface.get_character_count, atkHandle);
-				if (characterCount > 0 && iface.get_text != 0) {
-					long parentResult = ATK.call (iface.get_text, atkHandle, 0, characterCount);
-					if (parentResult != 0) {
-						parentText = getString (parentResult);
-						OS.g_free(parentResult);
-					}
+				characterCount = ATK.call (iface.get_character_count, atkHandle);
+			}
+			boolean keep = accessible.textChangesReported;
+			if (keep && textGeneration == accessible.textGeneration && textParentCount == characterCount) {
+				return text;
+			}
+			String parentText = "";	//$NON-NLS-1$
+			if (characterCount > 0 && iface.get_text != 0) {
+				long parentResult = ATK.call (iface.get_text, atkHandle, 0, characterCount);
+				if (parentResult != 0) {
+					parentText = getString (parentResult);
+					OS.g_free(parentResult);
 				}
 			}
 			AccessibleControlEvent event = new AccessibleControlEvent (accessible);
@@ -4474,7 +4503,11 @@ class AccessibleObject {
 				AccessibleControlListener listener = listeners.get (i);
 				listener.getValue (event);
 			}
-			return event.result;
+			if (!keep) return event.result;
+			text = event.result;
+			textParentCount = characterCount;
+			textGeneration = accessible.textGeneration;
+			return text;
 		}
 		return null;
 	}
@@ -4484,11 +4517,43 @@ class AccessibleObject {
 		 * GObject destruction is handled in os_custom.c in GTK3.
 		 * AccessibleObject has to be removed from the map of AccessibleObjects, though.
 		 */
-		AccessibleObject object = AccessibleObjects.get (new LONG (atkObject));
+		removeObject (atkObject);
+		return 0;
+	}
+
+	static void addObject (long handle, AccessibleObject object) {
+		if (handle == 0) return;
+		if (lastObjectHandle == handle) lastObject = null;
+		AccessibleObjects.put (new LONG (handle), object);
+	}
+
+	static AccessibleObject findObject (long handle) {
+		if (handle == 0) return null;
+		lookupCount++;
+		if (lastObject != null && lastObjectHandle == handle) {
+			lastObjectHits++;
+			return lastObject;
+		}
+		AccessibleObject object = AccessibleObjects.get (new LONG (handle));
 		if (object != null) {
-			AccessibleObjects.remove (new LONG (atkObject));
+			lastObjectHandle = handle;
+			lastObject = object;
 		}
-		return 0;
+		return object;
+	}
+
+	static void removeObject (long handle) {
+		if (handle == 0) return;
+		if (lastObjectHandle == handle) lastObject = null;
+		AccessibleObjects.remove (new LONG (handle));
+	}
+
+	/*
+	* Returns the number of objects, the number of lookups, and how many
+	* of them hit the last object.
+	*/
+	static long [] getObjectTableStatistics () {
+		return new long [] {AccessibleObjects.size (), lookupCount, lastObjectHits};
 	}
 
 	static int toATKRelation (int relation) {
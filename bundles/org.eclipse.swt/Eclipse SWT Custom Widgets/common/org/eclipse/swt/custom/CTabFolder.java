@@ -1,5 +1,5 @@
 /*******************************************************************************
- * Copyright (c) 2000, 2020 IBM Corporation and others.
+ * Copyright (c) 2000, 2026 IBM Corporation and others.
  *
  * This program and the accompanying materials
  * are made available under the terms of the Eclipse Public License 2.0
@@ -3237,7 +3237,17 @@ public void setSelection(int index) {
 		}
 	}
 	showItem(selection);
-	redraw();
+	/*
+	* The body only depends on whether there is a selection, so changing
+	* the selected tab only needs to repaint the tab row. All tabs between
+	* the old and the new selection change their borders, and the selected
+	* tab connects to the lines that span the row.
+	*/
+	if (oldIndex == -1) {
+		redraw();
+	} else {
+		redrawTabs();
+	}
 }
 void setSelection(int index, boolean notify) {
 	int oldSelectedIndex = selectedIndex;
@@ -1,5 +1,5 @@
 /*******************************************************************************
- * Copyright (c) 2000, 2020 IBM Corporation and others.
+ * Copyright (c) 2000, 2026 IBM Corporation and others.
  *
  * This program and the accompanying materials
  * are made available under the terms of the Eclipse Public License 2.0
@@ -14,6 +14,8 @@
  *******************************************************************************/
 package org.eclipse.swt.custom;
 
+import java.util.*;
+
 import org.eclipse.swt.*;
 import org.eclipse.swt.graphics.*;
 import org.eclipse.swt.widgets.*;
@@ -59,6 +61,53 @@ public class CTabFolderRenderer {
 
 	private Font chevronFont = null;
 
+	/* Counts of tab text measurements for layout and of tab paints, read by tests */
+	int measureCount, paintCount;
+
+	/*
+	 * Shortened tab texts, the least recently used ones are evicted. They
+	 * are keyed by the font data rather than the font, so that the cache
+	 * does not keep disposed fonts and a new font that reuses the handle
+	 * of a disposed one does not match its entries.
+	 */
+	static final int SHORTENED_TEXT_CACHE_SIZE = 512;
+	Font shortenedTextFont;
+	FontData[] shortenedTextFontData;
+	final Map<ShortenedTextKey, String> shortenedTexts = new LinkedHashMap<>(16, 0.75f, true) {
+		private static final long serialVersionUID = 1L;
+
+		@Override
+		protected boolean removeEldestEntry(Map.Entry<ShortenedTextKey, String> eldest) {
+			return size() > SHORTENED_TEXT_CACHE_SIZE;
+		}
+	};
+
+	static final class ShortenedTextKey {
+		final String text;
+		final FontData[] font;
+		final int width;
+		final String ellipses;
+
+		ShortenedTextKey(String text, FontData[] font, int width, String ellipses) {
+			this.text = text;
+			this.font = font;
+			this.width = width;
+			this.ellipses = ellipses;
+		}
+
+		@Override
+		public boolean equals(Object object) {
+			if (!(object instanceof ShortenedTextKey)) return false;
+			ShortenedTextKey key = (ShortenedTextKey) object;
+			return width == key.width && text.equals(key.text) && Arrays.equals(font, key.font) && ellipses.equals(key.ellipses);
+		}
+
+		@Override
+		public int hashCode() {
+			return (text.hashCode() * 31 + Arrays.hashCode(font)) * 31 + width;
+		}
+	}
+
 	//TOP_LEFT_CORNER_HILITE is laid out in reverse (ie. top to bottom)
 	//so can fade in same direction as right swoop curve
 	static final int[] TOP_LEFT_CORNER_HILITE = new int[] {5,2, 4,2, 3,3, 2,4, 2,5, 1,6};
@@ -342,18 +391,9 @@ public class CTabFolderRenderer {
 					}
 					if (text != null) {
 						if (width > 0) width += INTERNAL_SPACING;
-						if (item.font == null) {
-							Point size = gc.textExtent(text, FLAGS);
-							width += size.x;
-							height = Math.max(height, size.y);
-						} else {
-							Font gcFont = gc.getFont();
-							gc.setFont(item.font);
-							Point size = gc.textExtent(text, FLAGS);
-							width += size.x;
-							height = Math.max(height, size.y);
-							gc.setFont(gcFont);
-						}
+						Point size = getTextExtent(item, text, (state & MINIMUM_SIZE) != 0, gc);
+						width += size.x;
+						height = Math.max(height, size.y);
 					}
 					if (parent.showClose || item.showClose) {
 						if ((state & SWT.SELECTED) != 0 || parent.showUnselectedClose) {
@@ -548,6 +588,9 @@ public class CTabFolderRenderer {
 			chevronFont.dispose();
 			chevronFont = null;
 		}
+		shortenedTexts.clear();
+		shortenedTextFont = null;
+		shortenedTextFontData = null;
 	}
 
 	void disposeAntialiasColors() {
@@ -613,6 +656,7 @@ public class CTabFolderRenderer {
 			default:
 				if (0 <= part && part < parent.getItemCount()) {
 					if (bounds.width == 0 || bounds.height == 0) return;
+					paintCount++;
 					if ((state & SWT.SELECTED) != 0 ) {
 						drawSelected(part, gc, bounds, state);
 					} else {
@@ -1413,11 +1457,7 @@ public class CTabFolderRenderer {
 				Font gcFont = gc.getFont();
 				gc.setFont(item.font == null ? parent.getFont() : item.font);
 
-				if (item.shortenedText == null || item.shortenedTextWidth != textWidth) {
-					item.shortenedText = shortenText(gc, item.getText(), textWidth);
-					item.shortenedTextWidth = textWidth;
-				}
-				Point extent = gc.textExtent(item.shortenedText, FLAGS);
+				Point extent = getShortenedTextExtent(item, textWidth, gc);
 				int textY = y + (height - extent.y) / 2;
 				textY += parent.onBottom ? -1 : 1;
 
@@ -1627,11 +1667,7 @@ public class CTabFolderRenderer {
 			if (textWidth > 0) {
 				Font gcFont = gc.getFont();
 				gc.setFont(item.font == null ? parent.getFont() : item.font);
-				if (item.shortenedText == null || item.shortenedTextWidth != textWidth) {
-					item.shortenedText = shortenText(gc, item.getText(), textWidth);
-					item.shortenedTextWidth = textWidth;
-				}
-				Point extent = gc.textExtent(item.shortenedText, FLAGS);
+				Point extent = getShortenedTextExtent(item, textWidth, gc);
 				int textY = y + (height - extent.y) / 2;
 				textY += parent.onBottom ? -1 : 1;
 				gc.setForeground(item.foreground == null ? parent.getForeground() : item.foreground);
@@ -1733,29 +1769,113 @@ public class CTabFolderRenderer {
 			createSelectionHighlightGradientColors(start);  //if no cache hit then compute new ones
 	}
 
+	/*
+	 * Returns the extent of the full or the minimum text of the item.
+	 * Tab sizes are computed on every layout, and measuring the text is
+	 * the expensive part, so the extents are kept on the item until its
+	 * text or font changes, or the folder font changes.
+	 */
+	Point getTextExtent(CTabItem item, String text, boolean minimum, GC gc) {
+		Font font = item.font == null ? gc.getFont() : item.font;
+		if (!font.equals(item.textExtentFont)) {
+			item.textExtentFont = font;
+			item.textExtent = item.minimumTextExtent = null;
+		}
+		if (minimum) {
+			if (item.minimumTextExtent == null || !text.equals(item.minimumText)) {
+				item.minimumText = text;
+				item.minimumTextExtent = measureText(gc, font, text);
+			}
+			return item.minimumTextExtent;
+		}
+		if (item.textExtent == null) {
+			item.textExtent = measureText(gc, font, text);
+		}
+		return item.textExtent;
+	}
+
+	/*
+	 * Shortens the text of the item to the width and returns the extent of
+	 * the shortened text. Both are kept on the item until the width or the
+	 * font of the GC changes.
+	 */
+	Point getShortenedTextExtent(CTabItem item, int width, GC gc) {
+		Font font = gc.getFont();
+		if (item.shortenedText == null || item.shortenedTextWidth != width || !font.equals(item.shortenedTextFont)) {
+			item.shortenedText = shortenText(gc, item.getText(), width);
+			item.shortenedTextWidth = width;
+			item.shortenedTextFont = font;
+			item.shortenedTextExtent = gc.textExtent(item.shortenedText, FLAGS);
+		}
+		return item.shortenedTextExtent;
+	}
+
+	Point measureText(GC gc, Font font, String text) {
+		measureCount++;
+		Font gcFont = gc.getFont();
+		if (gcFont.equals(font)) return gc.textExtent(text, FLAGS);
+		gc.setFont(font);
+		Point size = gc.textExtent(text, FLAGS);
+		gc.setFont(gcFont);
+		return size;
+	}
+
 	String shortenText(GC gc, String text, int width) {
 		return useEllipses()
 			? shortenText(gc, text, width, ELLIPSIS)
 			: shortenText(gc, text, width, ""); //$NON-NLS-1$
 	}
 
+	/*
+	 * Returns the longest prefix of the text, ending at a cluster boundary,
+	 * that fits into the width together with the ellipses. The prefixes are
+	 * measured in a binary search over the cluster boundaries, which takes
+	 * O(log n) text extents instead of one for every shorter prefix. Results
+	 * are cached per text, font data, width and ellipses.
+	 */
 	String shortenText(GC gc, String text, int width, String ellipses) {
+		/* The font data is only queried when the font object changes */
+		Font font = gc.getFont();
+		if (font != shortenedTextFont) {
+			shortenedTextFontData = font.getFontData();
+			shortenedTextFont = font;
+		}
+		ShortenedTextKey key = new ShortenedTextKey(text, shortenedTextFontData, width, ellipses);
+		String result = shortenedTexts.get(key);
+		if (result == null) {
+			result = computeShortenedText(gc, text, width, ellipses);
+			shortenedTexts.put(key, result);
+		}
+		return result;
+	}
+
+	String computeShortenedText(GC gc, String text, int width, String ellipses) {
 		if (gc.textExtent(text, FLAGS).x <= width) return text;
 		int ellipseWidth = gc.textExtent(ellipses, FLAGS).x;
 		int length = text.length();
 		TextLayout layout = new TextLayout(parent.getDisplay());
 		layout.setText(text);
-		int end = layout.getPreviousOffset(length, SWT.MOVEMENT_CLUSTER);
-		while (end > 0) {
-			text = text.substring(0, end);
-			int l = gc.textExtent(text, FLAGS).x;
+		int[] boundaries = new int[length];
+		int count = 0;
+		int offset = layout.getNextOffset(0, SWT.MOVEMENT_CLUSTER);
+		while (offset < length) {
+			boundaries[count++] = offset;
+			offset = layout.getNextOffset(offset, SWT.MOVEMENT_CLUSTER);
+		}
+		layout.dispose();
+		/* Find the last boundary whose prefix fits, assuming prefix widths grow with length */
+		int low = 0, high = count - 1, end = 0;
+		while (low <= high) {
+			int mid = (low + high) >>> 1;
+			int l = gc.textExtent(text.substring(0, boundaries[mid]), FLAGS).x;
 			if (l + ellipseWidth <= width) {
-				break;
+				end = boundaries[mid];
+				low = mid + 1;
+			} else {
+				high = mid - 1;
 			}
-			end = layout.getPreviousOffset(end, SWT.MOVEMENT_CLUSTER);
 		}
-		layout.dispose();
-		return end == 0 ? text.substring(0, 1) : text + ellipses;
+		return end == 0 ? text.substring(0, 1) : text.substring(0, end) + ellipses;
 	}
 
 	void updateCurves () {
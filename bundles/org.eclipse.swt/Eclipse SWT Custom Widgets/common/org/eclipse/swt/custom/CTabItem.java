@@ -1,5 +1,5 @@
 /*******************************************************************************
- * Copyright (c) 2000, 2012 IBM Corporation and others.
+ * Copyright (c) 2000, 2026 IBM Corporation and others.
  *
  * This program and the accompanying materials
  * are made available under the terms of the Eclipse Public License 2.0
@@ -44,6 +44,13 @@ public class CTabItem extends Item {
 	String toolTipText;
 	String shortenedText;
 	int shortenedTextWidth;
+	Font shortenedTextFont;
+	Point shortenedTextExtent;
+
+	// Cached text extents, see CTabFolderRenderer.getTextExtent()
+	Font textExtentFont;
+	Point textExtent, minimumTextExtent;
+	String minimumText;
 
 	// Appearance
 	Font font;
@@ -403,6 +410,8 @@ public void setFont (Font font){
 	if (font == null && this.font == null) return;
 	if (font != null && font.equals(this.font)) return;
 	this.font = font;
+	textExtent = minimumTextExtent = null;
+	shortenedText = null;
 	parent.updateFolder(CTabFolder.UPDATE_TAB_HEIGHT | CTabFolder.REDRAW_TABS);
 }
 
@@ -507,6 +516,7 @@ public void setText (String string) {
 	if (string == null) SWT.error (SWT.ERROR_NULL_ARGUMENT);
 	if (string.equals(getText())) return;
 	super.setText(string);
+	textExtent = minimumTextExtent = null;
 	shortenedText = null;
 	shortenedTextWidth = 0;
 	parent.updateFolder(CTabFolder.UPDATE_TAB_HEIGHT | CTabFolder.REDRAW_TABS);
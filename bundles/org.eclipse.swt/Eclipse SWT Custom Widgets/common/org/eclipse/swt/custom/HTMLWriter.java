@@ -10,6 +10,8 @@
  *******************************************************************************/
 package org.eclipse.swt.custom;
 
+import java.io.*;
+
 import org.eclipse.swt.*;
 import org.eclipse.swt.graphics.*;
 
@@ -29,8 +31,19 @@ import org.eclipse.swt.graphics.*;
  */
 class HTMLWriter extends StyledTextWriterBase {
 
-	public HTMLWriter(StyledText styledText, int start, int length) {
-		super(styledText, start, length);
+	public HTMLWriter(StyledTextSnapshot snapshot) {
+		this(snapshot, null);
+	}
+
+	/**
+	 * Creates a writer that streams the HTML to the specified output.
+	 *
+	 * @param snapshot the widget content and styles to produce the HTML from
+	 * @param output the writer that receives the HTML in chunks, or
+	 *  <code>null</code> to keep it in memory
+	 */
+	HTMLWriter(StyledTextSnapshot snapshot, Writer output) {
+		super(snapshot, output);
 		writeHeader();
 	}
 
@@ -48,16 +61,16 @@ class HTMLWriter extends StyledTextWriterBase {
 		StringBuilder outerDivStyle = new StringBuilder();
 		StringBuilder innerDivStyle = new StringBuilder();
 
-		appendStyle(outerDivStyle, "background-color:", styledText.getMarginColor(), ";");
-		appendStyle(innerDivStyle, "color:", styledText.getForeground(), ";");
-		appendStyle(innerDivStyle, "background-color:", styledText.getBackground(), ";");
+		appendStyle(outerDivStyle, "background-color:", snapshot.marginColor, ";");
+		appendStyle(innerDivStyle, "color:", snapshot.foreground, ";");
+		appendStyle(innerDivStyle, "background-color:", snapshot.background, ";");
 
-		appendStyle(outerDivStyle, "padding-left:", styledText.getLeftMargin(), "px;");
-		appendStyle(outerDivStyle, "padding-top:", styledText.getTopMargin(), "px;");
-		appendStyle(outerDivStyle, "padding-right:", styledText.getRightMargin(), "px;");
-		appendStyle(outerDivStyle, "padding-bottom:", styledText.getBottomMargin(), "px;");
+		appendStyle(outerDivStyle, "padding-left:", snapshot.leftMargin, "px;");
+		appendStyle(outerDivStyle, "padding-top:", snapshot.topMargin, "px;");
+		appendStyle(outerDivStyle, "padding-right:", snapshot.rightMargin, "px;");
+		appendStyle(outerDivStyle, "padding-bottom:", snapshot.bottomMargin, "px;");
 
-		String language = appendFont(innerDivStyle, styledText.getFont(), 0);
+		String language = appendFont(innerDivStyle, snapshot.font, 0);
 
 		// Using wrapIndent like this messes up the line background (if set).
 //		int wrapIndent = styledText.getWrapIndent();
@@ -65,7 +78,7 @@ class HTMLWriter extends StyledTextWriterBase {
 //			appendStyle(globalStyle, "padding-left:", wrapIndent, "px;");
 //		}
 //		int indent = styledText.getIndent() - wrapIndent;
-		int indent = styledText.getIndent();
+		int indent = snapshot.indent;
 		if (indent != 0) {
 			appendStyle(innerDivStyle, "text-indent:", indent, "px;");
 		}
@@ -73,13 +86,13 @@ class HTMLWriter extends StyledTextWriterBase {
 		// TODO?
 //		int lineSpacing = styledText.getLineSpacing();
 
-		if (!styledText.getWordWrap()) {
+		if (!snapshot.wordWrap) {
 			appendStyle(innerDivStyle, "white-space:nowrap;");
 		}
 
-		appendAlignAndJustify(innerDivStyle, styledText.getAlignment(), styledText.getJustify());
+		appendAlignAndJustify(innerDivStyle, snapshot.alignment, snapshot.justify);
 
-		if (styledText.getOrientation() == SWT.RIGHT_TO_LEFT || styledText.getTextDirection() == SWT.RIGHT_TO_LEFT) {
+		if (snapshot.rightToLeft) {
 			appendStyle(innerDivStyle, "direction:rtl;");
 		}
 
@@ -106,7 +119,7 @@ class HTMLWriter extends StyledTextWriterBase {
 	}
 
 	@Override
-	String writeLineStart(Color lineBackground, int indent, int verticalIndent, int alignment, boolean justify) {
+	String[] createLineFragments(Color lineBackground, int indent, int verticalIndent, int alignment, boolean justify) {
 		StringBuilder paragraphStyle = new StringBuilder();
 
 		appendAlignAndJustify(paragraphStyle, alignment, justify);
@@ -121,18 +134,14 @@ class HTMLWriter extends StyledTextWriterBase {
 			appendStyle(paragraphStyle, "margin-top:", verticalIndent, "px;");
 		}
 
-		if (paragraphStyle.length() == 0) {
-			write("<p>");
-		} else {
-			write("<p style='" + paragraphStyle + "'>");
-		}
+		String lineStart = paragraphStyle.length() == 0 ? "<p>" : "<p style='" + paragraphStyle + "'>";
 
-		// This is what will be used to close the line
-		return "</p>";
+		// The second fragment will be used to close the line
+		return new String[] {lineStart, "</p>"};
 	}
 
 	@Override
-	String writeSpanStart(StyleRange style) {
+	String[] createSpanFragments(StyleRange style) {
 		StringBuilder spanStyle = new StringBuilder();
 
 		appendStyle(spanStyle, "color:", style.foreground, ";");
@@ -204,11 +213,12 @@ class HTMLWriter extends StyledTextWriterBase {
 			spanStyle2 = null;
 		}
 
+		StringBuilder spanStart = new StringBuilder();
 		if (spanStyle.length() != 0) {
-			write("<span style='" + spanStyle + "'>");
+			spanStart.append("<span style='").append(spanStyle).append("'>");
 		}
 		if (spanStyle2 != null) {
-			write("<span style='" + spanStyle2 + "'>");
+			spanStart.append("<span style='").append(spanStyle2).append("'>");
 		}
 
 		// This is what will be used to close the span
@@ -219,34 +229,38 @@ class HTMLWriter extends StyledTextWriterBase {
 		if (spanStyle.length() != 0) {
 			toCloseSpan.append("</span>");
 		}
-		return toCloseSpan.toString();
+		return new String[] {spanStart.toString(), toCloseSpan.toString()};
 	}
 
 	// ==== Helper methods ====
 
 	@Override
-	String escapeText(String string) {
-		// The resulting string is at least as long as the original.
-		StringBuilder result = new StringBuilder(string.length());
-		string.chars().forEach(ch -> {
-			switch (ch) {
+	void writeEscaped(String string, int start, int end) {
+		// Runs of characters that need no escaping are copied in one piece.
+		int runStart = start;
+		for (int i = start; i < end; i++) {
+			String entity;
+			switch (string.charAt(i)) {
 				case '&':
-					result.append("&amp;");
+					entity = "&amp;";
 					break;
 				case '"':
-					result.append("&quot;");
+					entity = "&quot;";
 					break;
 				case '<':
-					result.append("&lt;");
+					entity = "&lt;";
 					break;
 				case '>':
-					result.append("&gt;");
+					entity = "&gt;";
 					break;
 				default:
-					result.append((char) ch);
+					continue;
 			}
-		});
-		return result.toString();
+			write(string, runStart, i);
+			write(entity);
+			runStart = i + 1;
+		}
+		write(string, runStart, end);
 	}
 
 	// TODO: do we also want support for alpha?
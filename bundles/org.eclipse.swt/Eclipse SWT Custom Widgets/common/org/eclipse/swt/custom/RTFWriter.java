@@ -1,5 +1,5 @@
 /*******************************************************************************
- * Copyright (c) 2000, 2022 IBM Corporation and others.
+ * Copyright (c) 2000, 2026 IBM Corporation and others.
  *
  * This program and the accompanying materials
  * are made available under the terms of the Eclipse Public License 2.0
@@ -13,6 +13,7 @@
  *******************************************************************************/
 package org.eclipse.swt.custom;
 
+import java.io.*;
 import java.util.*;
 
 import org.eclipse.swt.*;
@@ -36,21 +37,54 @@ class RTFWriter extends StyledTextWriterBase {
 	static final int DEFAULT_BACKGROUND = 1;
 	List<Color> colorTable;
 	List<Font> fontTable;
+	Map<Color, Integer> colorIndices;
+	Map<Font, Integer> fontIndices;
+	/* Whether the RTF ends with a null character, as the clipboard expects */
+	boolean nullTerminated;
 
-	public RTFWriter(StyledText styledText, int start, int length) {
-		super(styledText, start, length);
+	public RTFWriter(StyledTextSnapshot snapshot) {
+		this(snapshot, null);
+	}
+
+	/**
+	 * Creates a writer that streams the RTF to the specified output.
+	 * The font and color tables are collected from the snapshot first,
+	 * so that the header can be written before the content. A streaming
+	 * snapshot queries the line styles for this in a first pass.
+	 *
+	 * @param snapshot the widget content and styles to produce the RTF from
+	 * @param output the writer that receives the RTF in chunks, or
+	 *  <code>null</code> to keep it in memory
+	 */
+	RTFWriter(StyledTextSnapshot snapshot, Writer output) {
+		super(snapshot, output);
+		nullTerminated = output == null;
 		colorTable = new ArrayList<>();
 		fontTable = new ArrayList<>();
-		colorTable.add(this.styledText.getForeground());
-		colorTable.add(this.styledText.getBackground());
-		fontTable.add(this.styledText.getFont());
+		colorIndices = new HashMap<>();
+		fontIndices = new HashMap<>();
+		getColorIndex(snapshot.foreground, DEFAULT_FOREGROUND);
+		colorTable.add(snapshot.background);
+		colorIndices.putIfAbsent(snapshot.background, DEFAULT_BACKGROUND);
+		getFontIndex(snapshot.font);
+		snapshot.forEachStyledLine(line -> {
+			getColorIndex(line.background, DEFAULT_BACKGROUND);
+			if (line.styles == null) return;
+			for (StyleRange style : line.styles) {
+				getColorIndex(style.foreground, DEFAULT_FOREGROUND);
+				getColorIndex(style.background, DEFAULT_BACKGROUND);
+				if (style.font != null) {
+					getFontIndex(style.font);
+				}
+			}
+		});
+		writeHeader();
 	}
 
 	@Override
 	public void close() {
 		if (!isClosed()) {
-			writeHeader();
-			write("\n}}\0");
+			write(nullTerminated ? "\n}}\0" : "\n}}");
 			super.close();
 		}
 	}
@@ -61,7 +95,7 @@ class RTFWriter extends StyledTextWriterBase {
 	@Override
 	void writeHeader() {
 		StringBuilder header = new StringBuilder();
-		FontData fontData = styledText.getFont().getFontData()[0];
+		FontData fontData = snapshot.font.getFontData()[0];
 		header.append("{\\rtf1\\ansi");
 		// specify code page, necessary for copy to work in bidi
 		// systems that don't support Unicode RTF.
@@ -98,7 +132,7 @@ class RTFWriter extends StyledTextWriterBase {
 		// font size is specified in half points
 		header.append(fontData.getHeight() * 2);
 		header.append(" ");
-		write(header.toString(), 0);
+		write(header.toString());
 	}
 
 	@Override
@@ -111,63 +145,65 @@ class RTFWriter extends StyledTextWriterBase {
 	}
 
 	@Override
-	String writeLineStart(Color lineBackground, int indent, int verticalIndent, int alignment, boolean justify) {
-		write("\\fi");
-		write(indent);
+	String[] createLineFragments(Color lineBackground, int indent, int verticalIndent, int alignment, boolean justify) {
+		StringBuilder lineStart = new StringBuilder();
+		lineStart.append("\\fi");
+		lineStart.append(indent);
 		switch (alignment) {
-			case SWT.LEFT: write("\\ql"); break;
-			case SWT.CENTER: write("\\qc"); break;
-			case SWT.RIGHT: write("\\qr"); break;
+			case SWT.LEFT: lineStart.append("\\ql"); break;
+			case SWT.CENTER: lineStart.append("\\qc"); break;
+			case SWT.RIGHT: lineStart.append("\\qr"); break;
 		}
 		if (justify) {
-			write("\\qj");
+			lineStart.append("\\qj");
 		}
-		write(" ");
+		lineStart.append(" ");
 
 		if (lineBackground != null) {
 			// Background colors are written using the {@code \chshdng0\chcbpat} tag (vs. the {@code \cb} tag).
-			write("{\\chshdng0\\chcbpat");
-			write(getColorIndex(lineBackground, DEFAULT_BACKGROUND));
-			write(" ");
+			lineStart.append("{\\chshdng0\\chcbpat");
+			lineStart.append(getColorIndex(lineBackground, DEFAULT_BACKGROUND));
+			lineStart.append(" ");
 		}
 
-		// This is what will be used to close the line
-		return lineBackground == null ? "" : "}";
+		// The second fragment will be used to close the line
+		return new String[] {lineStart.toString(), lineBackground == null ? "" : "}"};
 	}
 
 	@Override
-	String writeSpanStart(StyleRange style) {
-		write("{\\cf");
-		write(getColorIndex(style.foreground, DEFAULT_FOREGROUND));
+	String[] createSpanFragments(StyleRange style) {
+		StringBuilder spanStart = new StringBuilder();
+		spanStart.append("{\\cf");
+		spanStart.append(getColorIndex(style.foreground, DEFAULT_FOREGROUND));
 		int colorIndex = getColorIndex(style.background, DEFAULT_BACKGROUND);
 		if (colorIndex != DEFAULT_BACKGROUND) {
-			write("\\chshdng0\\chcbpat");
-			write(colorIndex);
+			spanStart.append("\\chshdng0\\chcbpat");
+			spanStart.append(colorIndex);
 		}
 		int fontStyle = style.fontStyle;
 		Font font = style.font;
 		if (font != null) {
 			int fontIndex = getFontIndex(font);
-			write("\\f");
-			write(fontIndex);
+			spanStart.append("\\f");
+			spanStart.append(fontIndex);
 			FontData fontData = font.getFontData()[0];
-			write("\\fs");
-			write(fontData.getHeight() * 2);
+			spanStart.append("\\fs");
+			spanStart.append(fontData.getHeight() * 2);
 			fontStyle = fontData.getStyle();
 		}
 		if ((fontStyle & SWT.BOLD) != 0) {
-			write("\\b");
+			spanStart.append("\\b");
 		}
 		if ((fontStyle & SWT.ITALIC) != 0) {
-			write("\\i");
+			spanStart.append("\\i");
 		}
 		if (style.underline) {
-			write("\\ul");
+			spanStart.append("\\ul");
 		}
 		if (style.strikeout) {
-			write("\\strike");
+			spanStart.append("\\strike");
 		}
-		write(" ");
+		spanStart.append(" ");
 
 		// This is what will be used to close the span
 		StringBuilder toCloseSpan = new StringBuilder();
@@ -184,29 +220,32 @@ class RTFWriter extends StyledTextWriterBase {
 			toCloseSpan.append("\\strike0");
 		}
 		toCloseSpan.append("}");
-		return toCloseSpan.toString();
+		return new String[] {spanStart.toString(), toCloseSpan.toString()};
 	}
 
 	// ==== Helper methods ====
 
 	@Override
-	String escapeText(String string) {
-		// The resulting string is at least as long as the original.
-		StringBuilder result = new StringBuilder(string.length());
-		string.chars().forEach(ch -> {
+	void writeEscaped(String string, int start, int end) {
+		// Runs of characters that need no escaping are copied in one piece.
+		int runStart = start;
+		for (int i = start; i < end; i++) {
+			char ch = string.charAt(i);
 			if (ch > 0x7F) {
-				result.append("\\u");
-				result.append(Integer.toString((short) ch));
-				result.append('?'); // ANSI representation (1 byte long, \\uc1)
+				write(string, runStart, i);
+				write("\\u");
+				write((short) ch);
+				write('?'); // ANSI representation (1 byte long, \\uc1)
+				runStart = i + 1;
 			} else if (ch == '}' || ch == '{' || ch == '\\') {
-				result.append('\\');
-				result.append((char) ch);
-			} else {
-				// Fixes bug 21698.
-				result.append((char) ch);
+				write(string, runStart, i);
+				write('\\');
+				write(ch);
+				runStart = i + 1;
 			}
-		});
-		return result.toString();
+			// Fixes bug 21698: all other characters are written as they are.
+		}
+		write(string, runStart, end);
 	}
 
 	/**
@@ -219,27 +258,27 @@ class RTFWriter extends StyledTextWriterBase {
 	 */
 	private int getColorIndex(Color color, int defaultIndex) {
 		if (color == null) return defaultIndex;
-		int index = colorTable.indexOf(color);
-		if (index == -1) {
+		Integer index = colorIndices.get(color);
+		if (index == null) {
 			index = colorTable.size();
 			colorTable.add(color);
+			colorIndices.put(color, index);
 		}
 		return index;
 	}
 
 	/**
-	 * Returns the index of the specified color in the RTF color table.
+	 * Returns the index of the specified font in the RTF font table.
 	 *
-	 * @param color the color
-	 * @param defaultIndex return value if color is null
-	 * @return the index of the specified color in the RTF color table
-	 *  or "defaultIndex" if "color" is null.
+	 * @param font the font
+	 * @return the index of the specified font in the RTF font table
 	 */
 	private int getFontIndex(Font font) {
-		int index = fontTable.indexOf(font);
-		if (index == -1) {
+		Integer index = fontIndices.get(font);
+		if (index == null) {
 			index = fontTable.size();
 			fontTable.add(font);
+			fontIndices.put(font, index);
 		}
 		return index;
 	}
@@ -18,6 +18,7 @@
 package org.eclipse.swt.custom;
 
 
+import java.io.*;
 import java.util.*;
 import java.util.stream.*;
 
@@ -4250,33 +4251,6 @@ int getPartialTopIndex() {
 	}
 	return topIndexY <= 0 ? topIndex : topIndex - 1;
 }
-/**
- * Returns the content in the specified range using the platform line
- * delimiter to separate lines.
- *
- * @param writer the TextWriter to write line text into
- * @return the content in the specified range using the platform line
- * 	delimiter to separate lines as written by the specified TextWriter.
- */
-String getPlatformDelimitedText(TextWriter writer) {
-	int end = writer.getStart() + writer.getCharCount();
-	int startLine = content.getLineAtOffset(writer.getStart());
-	int endLine = content.getLineAtOffset(end);
-	String endLineText = content.getLine(endLine);
-	int endLineOffset = content.getOffsetAtLine(endLine);
-
-	for (int i = startLine; i <= endLine; i++) {
-		writer.writeLine(content.getLine(i), content.getOffsetAtLine(i));
-		if (i < endLine) {
-			writer.writeLineDelimiter(PlatformLineDelimiter);
-		}
-	}
-	if (end > endLineOffset + endLineText.length()) {
-		writer.writeLineDelimiter(PlatformLineDelimiter);
-	}
-	writer.close();
-	return writer.toString();
-}
 /**
  * Returns all the ranges of text that have an associated StyleRange.
  * Returns an empty array if a LineStyleListener has been set.
@@ -8606,6 +8580,10 @@ void setCaretOffsets(int[] newOffsets, int alignment) {
 /**
  * Copies the specified text range to the clipboard.  The text will be placed
  * in the clipboard in plain text, HTML, and RTF formats.
+ * <p>
+ * Only a snapshot of the text and its styles is taken here. Each format
+ * is written from the snapshot when a paste target first requests it.
+ * </p>
  *
  * @param start start index of the text
  * @param length length of text to place in clipboard
@@ -8615,22 +8593,21 @@ void setCaretOffsets(int[] newOffsets, int alignment) {
  */
 void setClipboardContent(int start, int length, int clipboardType) throws SWTError {
 	if (clipboardType == DND.SELECTION_CLIPBOARD && !IS_GTK) return;
+	boolean styled = clipboardType != DND.SELECTION_CLIPBOARD;
+	StyledTextSnapshot snapshot = new StyledTextSnapshot(this, start, length, styled);
 	TextTransfer plainTextTransfer = TextTransfer.getInstance();
-	TextWriter plainTextWriter = new TextWriter(start, length);
-	String plainText = getPlatformDelimitedText(plainTextWriter);
+	Object plainText = snapshot.defer(() -> new TextWriter(start, length));
 	Object[] data;
 	Transfer[] types;
-	if (clipboardType == DND.SELECTION_CLIPBOARD) {
+	if (!styled) {
 		data = new Object[]{plainText};
 		types = new Transfer[]{plainTextTransfer};
 	} else {
 		RTFTransfer rtfTransfer = RTFTransfer.getInstance();
-		RTFWriter rtfWriter = new RTFWriter(this, start, length);
-		String rtfText = getPlatformDelimitedText(rtfWriter);
+		Object rtfText = snapshot.defer(() -> new RTFWriter(snapshot));
 
 		HTMLTransfer htmlTransfer = HTMLTransfer.getInstance();
-		HTMLWriter htmlWriter = new HTMLWriter(this, start, length);
-		String htmlText = getPlatformDelimitedText(htmlWriter);
+		Object htmlText = snapshot.defer(() -> new HTMLWriter(snapshot));
 
 		data = new Object[]{rtfText, htmlText, plainText};
 		types = new Transfer[]{rtfTransfer, htmlTransfer, plainTextTransfer};
@@ -10844,5 +10821,85 @@ void updateSelection(int startOffset, int replacedLength, int newLength) {
 		.toArray(), true, false);
 	setCaretLocations();
 }
+/**
+ * Writes the specified range of the widget content as HTML.
+ * <p>
+ * The HTML is the same as the one placed on the clipboard by <code>copy()</code>.
+ * It is generated line by line from the widget content and passed on to the
+ * writer in chunks, so neither the text of the range nor the formatted
+ * document is held in memory as a whole. The writer is flushed, but not
+ * closed.
+ * </p>
+ *
+ * @param writer the writer that receives the HTML
+ * @param start offset of the first character to write
+ * @param length number of characters to write
+ * @return the number of characters written to the writer
+ * @exception IOException if the writer fails
+ * @exception SWTException <ul>
+ *    <li>ERROR_WIDGET_DISPOSED - if the receiver has been disposed</li>
+ *    <li>ERROR_THREAD_INVALID_ACCESS - if not called from the thread that created the receiver</li>
+ * </ul>
+ * @exception IllegalArgumentException <ul>
+ *   <li>ERROR_NULL_ARGUMENT when writer is null</li>
+ *   <li>ERROR_INVALID_RANGE when start and/or length are outside the widget content</li>
+ * </ul>
+ *
+ * @see #writeRTF(Writer, int, int)
+ * @since 3.122
+ */
+public long writeHTML(Writer writer, int start, int length) throws IOException {
+	return writeRichText(writer, start, length, false);
+}
+/**
+ * Writes the specified range of the widget content as RTF.
+ * <p>
+ * The RTF is the same as the one placed on the clipboard by <code>copy()</code>.
+ * It is generated line by line from the widget content and passed on to the
+ * writer in chunks, so neither the text of the range nor the formatted
+ * document is held in memory as a whole. The styles of each line are
+ * queried twice, once to collect the font and color tables and once to
+ * write the line, so a <code>LineStyleListener</code> is called twice for
+ * each line. The writer is flushed, but not closed.
+ * </p>
+ *
+ * @param writer the writer that receives the RTF
+ * @param start offset of the first character to write
+ * @param length number of characters to write
+ * @return the number of characters written to the writer
+ * @exception IOException if the writer fails
+ * @exception SWTException <ul>
+ *    <li>ERROR_WIDGET_DISPOSED - if the receiver has been disposed</li>
+ *    <li>ERROR_THREAD_INVALID_ACCESS - if not called from the thread that created the receiver</li>
+ * </ul>
+ * @exception IllegalArgumentException <ul>
+ *   <li>ERROR_NULL_ARGUMENT when writer is null</li>
+ *   <li>ERROR_INVALID_RANGE when start and/or length are outside the widget content</li>
+ * </ul>
+ *
+ * @see #writeHTML(Writer, int, int)
+ * @since 3.122
+ */
+public long writeRTF(Writer writer, int start, int length) throws IOException {
+	return writeRichText(writer, start, length, true);
+}
+long writeRichText(Writer writer, int start, int length, boolean rtf) throws IOException {
+	checkWidget();
+	if (writer == null) {
+		SWT.error(SWT.ERROR_NULL_ARGUMENT);
+	}
+	int end = start + length;
+	if (start > end || start < 0 || end > getCharCount()) {
+		SWT.error(SWT.ERROR_INVALID_RANGE);
+	}
+	StyledTextSnapshot snapshot = new StyledTextSnapshot(this, start, length, true, true);
+	try {
+		TextWriter textWriter = rtf ? new RTFWriter(snapshot, writer) : new HTMLWriter(snapshot, writer);
+		snapshot.write(textWriter);
+		return textWriter.getWrittenCount();
+	} catch (UncheckedIOException e) {
+		throw e.getCause();
+	}
+}
 
 }
@@ -0,0 +1,354 @@
+/*******************************************************************************
+ * Copyright (c) 2026 IBM Corporation and others.
+ *
+ * This program and the accompanying materials
+ * are made available under the terms of the Eclipse Public License 2.0
+ * which accompanies this distribution, and is available at
+ * https://www.eclipse.org/legal/epl-2.0/
+ *
+ * SPDX-License-Identifier: EPL-2.0
+ *
+ * Contributors:
+ *     IBM Corporation - initial API and implementation
+ *******************************************************************************/
+package org.eclipse.swt.custom;
+
+import java.util.*;
+import java.util.function.*;
+
+import org.eclipse.swt.*;
+import org.eclipse.swt.graphics.*;
+import org.eclipse.swt.internal.*;
+
+/**
+ * A copy of a range of {@link StyledText} content, together with the line
+ * styles and the widget properties needed to write it as plain text, RTF
+ * or HTML.
+ *
+ * <p>It is taken when text is copied to the clipboard. The clipboard
+ * formats are written from the snapshot when a paste target requests
+ * them, so the widget can be modified or disposed in the meantime.</p>
+ *
+ * <p>Taking a snapshot copies the text of the lines spanned by the range
+ * and queries the styles of each line once. Lines with the default
+ * attributes and no styles share a single line description.</p>
+ *
+ * <p>A streaming snapshot copies only the widget properties. It reads the
+ * text and styles of each line from the widget while it is written, so
+ * the widget must not change until the snapshot has been written.</p>
+ */
+class StyledTextSnapshot {
+	/** The attributes and styles of one line */
+	static final class Line {
+		int[] ranges;
+		StyleRange[] styles;
+		Color background;
+		int indent;
+		int verticalIndent;
+		int alignment;
+		boolean justify;
+	}
+
+	final int start;
+	final int length;
+	/** The widget that a streaming snapshot reads its lines from, <code>null</code> for a copy */
+	final StyledText source;
+	/** The line being written by a streaming snapshot */
+	Line currentLine;
+	/** The index of the first line spanned by the range */
+	final int startLine;
+	/** The number of lines spanned by the range */
+	final int lineCount;
+	/** The document offset of the first line spanned by the range */
+	final int firstLineOffset;
+	/** The text of the lines spanned by the range, including their delimiters, <code>null</code> when streaming */
+	final String text;
+	/** The start of each line, relative to {@link #text}, <code>null</code> when streaming */
+	final int[] lineStarts;
+	/** The line descriptions, <code>null</code> entries use {@link #defaultLine} */
+	Line[] lines;
+	final Line defaultLine;
+	/** The end of the last line, without the line delimiter, relative to {@link #text} */
+	final int lastLineEnd;
+	/** Whether the range ends inside the delimiter of its last line */
+	final boolean endsInDelimiter;
+
+	final Font font;
+	final Color foreground;
+	final Color background;
+	final Color marginColor;
+	final int leftMargin;
+	final int topMargin;
+	final int rightMargin;
+	final int bottomMargin;
+	final int indent;
+	final int alignment;
+	final boolean justify;
+	final boolean wordWrap;
+	final boolean rightToLeft;
+
+/**
+ * Takes a snapshot of the specified range.
+ *
+ * @param styledText the widget
+ * @param start start offset of the range, 0 based from beginning of document
+ * @param length length of the range
+ * @param styled whether to capture the line styles, which are only needed for rich text
+ */
+StyledTextSnapshot(StyledText styledText, int start, int length, boolean styled) {
+	this(styledText, start, length, styled, false);
+}
+
+/**
+ * Takes a snapshot of the specified range, or only of the widget
+ * properties for a streaming snapshot.
+ *
+ * @param styledText the widget
+ * @param start start offset of the range, 0 based from beginning of document
+ * @param length length of the range
+ * @param styled whether to capture the line styles, which are only needed for rich text
+ * @param streaming whether to read the text and styles of each line from the widget
+ *  while the snapshot is written instead of copying them, so that the memory used
+ *  does not depend on the size of the range
+ */
+StyledTextSnapshot(StyledText styledText, int start, int length, boolean styled, boolean streaming) {
+	this.start = start;
+	this.length = length;
+	StyledTextContent content = styledText.content;
+	int end = start + length;
+	startLine = content.getLineAtOffset(start);
+	int endLine = content.getLineAtOffset(end);
+	lineCount = endLine - startLine + 1;
+	firstLineOffset = content.getOffsetAtLine(startLine);
+	int endLineOffset = content.getOffsetAtLine(endLine);
+	int textEnd = endLineOffset + content.getLine(endLine).length();
+	lastLineEnd = textEnd - firstLineOffset;
+	endsInDelimiter = end > textEnd;
+	if (streaming) {
+		source = styledText;
+		text = null;
+		lineStarts = null;
+	} else {
+		source = null;
+		text = content.getTextRange(firstLineOffset, Math.max(textEnd, end) - firstLineOffset);
+		lineStarts = new int[lineCount];
+		for (int i = 1; i < lineStarts.length; i++) {
+			lineStarts[i] = content.getOffsetAtLine(startLine + i) - firstLineOffset;
+		}
+	}
+
+	font = styledText.getFont();
+	foreground = styledText.getForeground();
+	background = styledText.getBackground();
+	marginColor = styledText.getMarginColor();
+	leftMargin = styledText.getLeftMargin();
+	topMargin = styledText.getTopMargin();
+	rightMargin = styledText.getRightMargin();
+	bottomMargin = styledText.getBottomMargin();
+	indent = styledText.indent;
+	alignment = styledText.alignment;
+	justify = styledText.justify;
+	wordWrap = styledText.getWordWrap();
+	rightToLeft = styledText.getOrientation() == SWT.RIGHT_TO_LEFT || styledText.getTextDirection() == SWT.RIGHT_TO_LEFT;
+
+	defaultLine = new Line();
+	defaultLine.indent = indent;
+	defaultLine.alignment = alignment;
+	defaultLine.justify = justify;
+	if (styled && !streaming) {
+		captureStyles(styledText);
+	}
+}
+
+void captureStyles(StyledText styledText) {
+	boolean lineListeners = hasLineListeners(styledText);
+	for (int i = 0; i < lineStarts.length; i++) {
+		String lineText = lineListeners ? getLine(i) : null;
+		Line line = queryLine(styledText, startLine + i, firstLineOffset + lineStarts[i], lineText, getLineEnd(i) - lineStarts[i], lineListeners);
+		if (line == null) {
+			continue;
+		}
+		if (lines == null) {
+			lines = new Line[lineStarts.length];
+		}
+		lines[i] = line;
+	}
+}
+
+static boolean hasLineListeners(StyledText styledText) {
+	return styledText.isListening(ST.LineGetStyle) || styledText.isListening(ST.LineGetBackground);
+}
+
+/**
+ * Queries the attributes and styles of a line from the widget.
+ *
+ * @param lineText the line text, only needed when there are line listeners
+ * @return the line description, or <code>null</code> if the line has the
+ *  default attributes and no styles
+ */
+Line queryLine(StyledText styledText, int lineIndex, int lineOffset, String lineText, int lineLength, boolean lineListeners) {
+	StyledTextRenderer renderer = styledText.renderer;
+	Line line = new Line();
+	StyledTextEvent event = null;
+	if (lineListeners) {
+		event = styledText.getLineStyleData(lineOffset, lineText);
+	}
+	if (event != null) {
+		line.verticalIndent = event.verticalIndent;
+		line.alignment = event.alignment;
+		line.indent = event.indent;
+		line.justify = event.justify;
+		line.ranges = event.ranges;
+		line.styles = event.styles;
+	} else {
+		line.verticalIndent = renderer.getLineVerticalIndent(lineIndex);
+		line.alignment = renderer.getLineAlignment(lineIndex, alignment);
+		line.indent = renderer.getLineIndent(lineIndex, indent);
+		line.justify = renderer.getLineJustify(lineIndex, justify);
+		line.ranges = renderer.getRanges(lineOffset, lineLength);
+		line.styles = renderer.getStyleRanges(lineOffset, lineLength, false);
+	}
+	event = lineListeners ? styledText.getLineBackgroundData(lineOffset, lineText) : null;
+	line.background = (event != null && event.lineBackground != null)
+			? event.lineBackground
+			: renderer.getLineBackground(lineIndex, null);
+	if (line.styles != null && line.styles.length == 0) {
+		line.styles = null;
+	}
+	if (line.styles == null && line.background == null && line.verticalIndent == 0 && line.indent == indent
+			&& line.alignment == alignment && line.justify == justify) {
+		return null;
+	}
+	return line;
+}
+
+/**
+ * Passes the description of each line that does not have the default
+ * attributes to the consumer. A streaming snapshot queries the lines
+ * from the widget.
+ *
+ * @param consumer receives the line descriptions
+ */
+void forEachStyledLine(Consumer<Line> consumer) {
+	if (source == null) {
+		if (lines == null) return;
+		for (Line line : lines) {
+			if (line != null) consumer.accept(line);
+		}
+		return;
+	}
+	StyledTextContent content = source.content;
+	boolean lineListeners = hasLineListeners(source);
+	for (int i = 0; i < lineCount; i++) {
+		int lineIndex = startLine + i;
+		String lineText = content.getLine(lineIndex);
+		Line line = queryLine(source, lineIndex, content.getOffsetAtLine(lineIndex), lineText, lineText.length(), lineListeners);
+		if (line != null) consumer.accept(line);
+	}
+}
+
+/**
+ * Returns the text of the specified line, without the line delimiter.
+ *
+ * @param index the index of the line in the snapshot
+ * @return the line text
+ */
+String getLine(int index) {
+	return text.substring(lineStarts[index], getLineEnd(index));
+}
+
+/**
+ * Returns the end of the specified line, without the line delimiter,
+ * relative to {@link #text}.
+ */
+int getLineEnd(int index) {
+	if (index == lineStarts.length - 1) {
+		return lastLineEnd;
+	}
+	return lineStarts[index + 1] - delimiterLength(lineStarts[index + 1]);
+}
+
+/**
+ * Returns the length of the line delimiter that ends at the specified offset.
+ */
+int delimiterLength(int end) {
+	if (end > 0 && text.charAt(end - 1) == '\n') {
+		return end > 1 && text.charAt(end - 2) == '\r' ? 2 : 1;
+	}
+	return end > 0 && text.charAt(end - 1) == '\r' ? 1 : 0;
+}
+
+/**
+ * Returns the attributes and styles of the line at the specified document offset.
+ *
+ * @param lineOffset the offset of a line start, 0 based from beginning of document
+ * @return the line description
+ */
+Line getLineData(int lineOffset) {
+	if (source != null) return currentLine != null ? currentLine : defaultLine;
+	if (lines == null) return defaultLine;
+	int index = Arrays.binarySearch(lineStarts, lineOffset - firstLineOffset);
+	Line line = index >= 0 ? lines[index] : null;
+	return line != null ? line : defaultLine;
+}
+
+/**
+ * Writes the range to the specified writer using the platform line
+ * delimiter to separate lines, and closes the writer.
+ *
+ * @param writer the writer, created for the range of this snapshot
+ * @return the content written by the writer
+ */
+String write(TextWriter writer) {
+	int lastLine = lineCount - 1;
+	if (source != null) {
+		StyledTextContent content = source.content;
+		boolean lineListeners = hasLineListeners(source);
+		for (int i = 0; i <= lastLine; i++) {
+			int lineIndex = startLine + i;
+			int lineOffset = content.getOffsetAtLine(lineIndex);
+			String lineText = content.getLine(lineIndex);
+			currentLine = queryLine(source, lineIndex, lineOffset, lineText, lineText.length(), lineListeners);
+			writer.writeLine(lineText, lineOffset);
+			if (i < lastLine) {
+				writer.writeLineDelimiter(StyledText.PlatformLineDelimiter);
+			}
+		}
+		currentLine = null;
+	} else {
+		for (int i = 0; i <= lastLine; i++) {
+			writer.writeLine(getLine(i), firstLineOffset + lineStarts[i]);
+			if (i < lastLine) {
+				writer.writeLineDelimiter(StyledText.PlatformLineDelimiter);
+			}
+		}
+	}
+	if (endsInDelimiter) {
+		writer.writeLineDelimiter(StyledText.PlatformLineDelimiter);
+	}
+	writer.close();
+	return writer.toString();
+}
+
+/**
+ * Returns clipboard data that is written from this snapshot by a new
+ * writer when a paste target first requests it.
+ *
+ * @param writer creates the writer for the format
+ * @return the deferred clipboard data
+ */
+DeferredContent defer(Supplier<TextWriter> writer) {
+	return new DeferredContent() {
+		@Override
+		protected Object compute() {
+			try {
+				return write(writer.get());
+			} catch (SWTException e) {
+				/* A font used by the copied styles has been disposed */
+				if (e.code != SWT.ERROR_GRAPHIC_DISPOSED) throw e;
+				return null;
+			}
+		}
+	};
+}
+}
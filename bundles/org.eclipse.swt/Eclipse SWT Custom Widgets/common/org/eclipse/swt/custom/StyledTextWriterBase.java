@@ -1,5 +1,5 @@
 /*******************************************************************************
- * Copyright (c) 2000, 2022 IBM Corporation and others.
+ * Copyright (c) 2000, 2026 IBM Corporation and others.
  *
  * This program and the accompanying materials
  * are made available under the terms of the Eclipse Public License 2.0
@@ -13,6 +13,9 @@
  *******************************************************************************/
 package org.eclipse.swt.custom;
 
+import java.io.*;
+import java.util.*;
+
 import org.eclipse.swt.*;
 import org.eclipse.swt.graphics.*;
 
@@ -31,40 +34,76 @@ import org.eclipse.swt.graphics.*;
  * widget font name and size is used for the whole text.</p>
  */
 abstract class StyledTextWriterBase extends TextWriter {
-	final StyledText styledText;
+	/** The maximum number of distinct styles whose span fragments are kept */
+	static final int SPAN_CACHE_SIZE = 1024;
+	static final StyleRange[] NO_STYLES = new StyleRange[0];
+
+	final StyledTextSnapshot snapshot;
+	String[] defaultLineFragments;
+	final Map<StyleRange, String[]> spanFragments = new IdentityHashMap<>();
+	final Map<SpanKey, String[]> similarSpanFragments = new HashMap<>();
+
+	/**
+	 * Identifies the styles that produce the same span fragments,
+	 * ignoring their start and length.
+	 */
+	static final class SpanKey {
+		final StyleRange style;
+
+		SpanKey(StyleRange style) {
+			this.style = style;
+		}
+
+		@Override
+		public boolean equals(Object object) {
+			return object instanceof SpanKey && style.similarTo(((SpanKey) object).style);
+		}
+
+		@Override
+		public int hashCode() {
+			return style.hashCode();
+		}
+	}
 
 	/**
-	 * Creates a writer that processed content starting at offset "start"
-	 * in the document. {@code start} and {@code length} can be set to specify
-	 * partial lines.
+	 * Creates a writer that processes the content range of the snapshot.
+	 * The range can start and end in partial lines.
 	 *
-	 * @param start start offset of content to write, 0 based from beginning of document
-	 * @param length length of content to write
-	 * @param styledText the widget to produce the RTF from
+	 * @param snapshot the widget content and styles to produce the output from
 	 */
-	public StyledTextWriterBase(StyledText styledText, int start, int length) {
-		super(start, length);
-		this.styledText = styledText;
+	public StyledTextWriterBase(StyledTextSnapshot snapshot) {
+		this(snapshot, null);
 	}
 
 	/**
-	 * Appends the specified segment of "string" to the output data.
+	 * Creates a writer that processes the content range of the snapshot and
+	 * streams the output to the specified writer.
+	 *
+	 * @param snapshot the widget content and styles to produce the output from
+	 * @param output the writer that receives the output in chunks, or
+	 *  <code>null</code> to keep it in memory
+	 */
+	StyledTextWriterBase(StyledTextSnapshot snapshot, Writer output) {
+		super(snapshot.start, snapshot.length, output);
+		this.snapshot = snapshot;
+	}
+
+	/**
+	 * Appends the specified segment of "string" to the output data, escaped
+	 * using the rules of the output format.
 	 * Copy from {@code start} up to, but excluding, {@code end}.
 	 *
 	 * @param string string to copy a segment from. Must not contain line breaks.
-	 *  Line breaks should be written using {@link #writeLineDelimiter()}
+	 *  Line breaks should be written using {@link #writeLineDelimiter(String)}
 	 * @param start start offset of segment. 0 based.
 	 * @param end end offset of segment
 	 */
-	void writeEscaped(String string, int start, int end) {
-		String textToWrite = string.substring(start, end);
-		write(escapeText(textToWrite));
-	}
+	abstract void writeEscaped(String string, int start, int end);
 
 	/**
 	 * Appends the specified line text to the output data. Lines will be formatted
-	 * using the styles queried from the LineStyleListener, if set, or those set
-	 * directly in the widget.
+	 * using the styles that the snapshot captured from the LineStyleListener, if
+	 * set, or those set directly in the widget.
 	 *
 	 * @param line line text to write. Must not contain line breaks
 	 *  Line breaks should be written using {@link #writeLineDelimiter(String)}
@@ -79,63 +118,24 @@ abstract class StyledTextWriterBase extends TextWriter {
 		if (isClosed()) {
 			SWT.error(SWT.ERROR_IO);
 		}
-
-		int lineIndex = styledText.content.getLineAtOffset(lineOffset);
-		int lineAlignment;
-		int lineIndent;
-		boolean lineJustify;
-		int verticalIndent;
-		int[] ranges;
-		StyleRange[] styles;
-
-		StyledTextEvent event = styledText.getLineStyleData(lineOffset, line);
-		if (event != null) {
-			verticalIndent = event.verticalIndent;
-			lineAlignment = event.alignment;
-			lineIndent = event.indent;
-			lineJustify = event.justify;
-			ranges = event.ranges;
-			styles = event.styles;
-		} else {
-			verticalIndent = styledText.renderer.getLineVerticalIndent(lineIndex);
-			lineAlignment = styledText.renderer.getLineAlignment(lineIndex, styledText.alignment);
-			lineIndent = styledText.renderer.getLineIndent(lineIndex, styledText.indent);
-			lineJustify = styledText.renderer.getLineJustify(lineIndex, styledText.justify);
-			ranges = styledText.renderer.getRanges(lineOffset, line.length());
-			styles = styledText.renderer.getStyleRanges(lineOffset, line.length(), false);
-		}
-
-		if (styles == null) {
-			styles = new StyleRange[0];
-		}
-
-		event = styledText.getLineBackgroundData(lineOffset, line);
-		Color lineBackground = (event != null && event.lineBackground != null)
-				? event.lineBackground
-				: styledText.renderer.getLineBackground(lineIndex, null);
-
-		writeStyledLine(line, lineOffset, ranges, styles, lineBackground, lineIndent, verticalIndent, lineAlignment, lineJustify);
+		writeStyledLine(line, lineOffset, snapshot.getLineData(lineOffset));
 	}
 
 	/**
 	 * Appends the specified line text to the output data.
 	 *
-	 * <p>Use the colors and font styles specified in {@code styles} and {@code lineBackground}.
-	 * Formatting is written to reflect the text rendering by the text widget.
+	 * <p>Use the colors and font styles specified in the styles and background of
+	 * the line. Formatting is written to reflect the text rendering by the text widget.
 	 * Style background colors take precedence over the line background color.</p>
 	 *
-	 * @param line line text to write as RTF. Must not contain line breaks
+	 * @param line line text to write. Must not contain line breaks
 	 *  Line breaks should be written using writeLineDelimiter()
 	 * @param lineOffset offset of the line. 0 based from the start of the
 	 *  widget document. Any text occurring before the start offset or after the
 	 *  end offset specified during object creation is ignored.
-	 * @param styles styles to use for formatting. Must not be null.
-	 * @param lineBackground line background color to use for formatting.
-	 *  May be null.
+	 * @param data the attributes and styles of the line
 	 */
-	void writeStyledLine(String line, int lineOffset, int ranges[], StyleRange[] styles,
-			Color lineBackground, int indent, int verticalIndent, int alignment, boolean justify) {
-
+	void writeStyledLine(String line, int lineOffset, StyledTextSnapshot.Line data) {
 		int lineLength = line.length();
 		int startOffset = getStart();
 		int writeOffset = startOffset - lineOffset;
@@ -144,10 +144,13 @@ abstract class StyledTextWriterBase extends TextWriter {
 		}
 		int lineIndex = Math.max(0, writeOffset);
 
-		String atLineEnd = writeLineStart(lineBackground, indent, verticalIndent, alignment, justify);
+		String[] lineFragments = getLineFragments(data);
+		write(lineFragments[0]);
 
 		int endOffset = startOffset + super.getCharCount();
 		int lineEndOffset = Math.min(lineLength, endOffset - lineOffset);
+		int[] ranges = data.ranges;
+		StyleRange[] styles = data.styles != null ? data.styles : NO_STYLES;
 
 		for (int i = 0; i < styles.length; i++) {
 			StyleRange style = styles[i];
@@ -176,7 +179,8 @@ abstract class StyledTextWriterBase extends TextWriter {
 				lineIndex = start;
 			}
 			// write styled text
-			String atSpanEnd = writeSpanStart(style);
+			String[] spanFragments = getSpanFragments(style);
+			write(spanFragments[0]);
 
 			// copy to end of style or end of write range or end of line
 			int copyEnd = Math.min(end, lineEndOffset);
@@ -184,7 +188,7 @@ abstract class StyledTextWriterBase extends TextWriter {
 			copyEnd = Math.max(copyEnd, lineIndex);
 			writeEscaped(line, lineIndex, copyEnd);
 
-			writeSpanEnd(atSpanEnd);
+			write(spanFragments[1]);
 
 			lineIndex = copyEnd;
 		}
@@ -194,62 +198,69 @@ abstract class StyledTextWriterBase extends TextWriter {
 			writeEscaped(line, lineIndex, lineEndOffset);
 		}
 
-		writeLineEnd(atLineEnd);
+		write(lineFragments[1]);
 	}
 
 	/**
-	 * Writes the part that only shows once, at the beginning of the output data.
+	 * Returns the fragments written at the start and the end of the line.
+	 * Lines with the default attributes share the same fragments.
 	 */
-	abstract void writeHeader();
+	String[] getLineFragments(StyledTextSnapshot.Line data) {
+		if (data == snapshot.defaultLine) {
+			if (defaultLineFragments == null) {
+				defaultLineFragments = createLineFragments(data.background, data.indent, data.verticalIndent, data.alignment, data.justify);
+			}
+			return defaultLineFragments;
+		}
+		return createLineFragments(data.background, data.indent, data.verticalIndent, data.alignment, data.justify);
+	}
 
 	/**
-	 * Takes plain text and returns the same text escaped using the rules of the output format.
-	 * @param text the text to escape
-	 * @return the escaped text
+	 * Returns the fragments written at the start and the end of a span with
+	 * the specified style. The fragments of up to {@link #SPAN_CACHE_SIZE}
+	 * distinct styles are kept, first by identity and then by similarity.
 	 */
-	abstract String escapeText(String text);
-
-	/**
-	 * Invoked at the beginning of each line in the original widget.
-	 *
-	 * <p>It should output whatever tags are appropriate to start a new line in the output format.<br>
-	 * It will return the text that has to be output at the end of the line.</p>
-	 *
-	 * @return the text to append at the end of the line
-	 */
-	abstract String writeLineStart(Color lineBackground, int indent, int verticalIndent, int alignment, boolean justify);
+	String[] getSpanFragments(StyleRange style) {
+		String[] fragments = spanFragments.get(style);
+		if (fragments != null) return fragments;
+		SpanKey key = new SpanKey(style);
+		fragments = similarSpanFragments.get(key);
+		if (fragments == null) {
+			fragments = createSpanFragments(style);
+			if (similarSpanFragments.size() >= SPAN_CACHE_SIZE) return fragments;
+			similarSpanFragments.put(key, fragments);
+		}
+		if (spanFragments.size() < SPAN_CACHE_SIZE) {
+			spanFragments.put(style, fragments);
+		}
+		return fragments;
+	}
 
 	/**
-	 * Invoked at the end of of each line in the original widget.
-	 *
-	 * <p>It receives whatever text {@link #writeLineStart(Color,int,int,int,boolean)} returned
-	 * and it will output it. A class might override it to do more.</p>
-	 *
-	 * @param prepared the leftover text prepared by {@code writeLineStart}
+	 * Writes the part that only shows once, at the beginning of the output data.
 	 */
-	void writeLineEnd(String prepared) {
-		write(prepared);
-	}
+	abstract void writeHeader();
 
 	/**
-	 * Invoked at the beginning of each styled span fragment in the original widget.
+	 * Invoked for each line in the original widget that does not share the
+	 * fragments of the default line.
 	 *
-	 * <p>It should output whatever tags are appropriate to start a formatted span in the output format.<br>
-	 * It will return the text that has to be output at the end of the span (to close it).</p>
+	 * <p>It should return whatever tags are appropriate to start a new line in the
+	 * output format, and the text that has to be output at the end of the line.</p>
 	 *
-	 * @return the text to append at the end of the styled span
+	 * @return the text to write at the start and at the end of the line
 	 */
-	abstract String writeSpanStart(StyleRange style);
+	abstract String[] createLineFragments(Color lineBackground, int indent, int verticalIndent, int alignment, boolean justify);
 
 	/**
-	 * Invoked at the end of of each styled span fragment in the original widget.
+	 * Invoked for each styled span fragment in the original widget whose style
+	 * is not in the cache.
 	 *
-	 * <p>It receives whatever text {@link #writeSpanStart(StyleRange)} returned
-	 * and it will output it. A class might override it to do more.</p>
+	 * <p>It should return whatever tags are appropriate to start a formatted span in
+	 * the output format, and the text that has to be output at the end of the span
+	 * (to close it).</p>
 	 *
-	 * @param prepared the leftover text prepared by {@code writeSpanStart}
+	 * @return the text to write at the start and at the end of the styled span
 	 */
-	void writeSpanEnd(String prepared) {
-		write(prepared);
-	}
+	abstract String[] createSpanFragments(StyleRange style);
 }
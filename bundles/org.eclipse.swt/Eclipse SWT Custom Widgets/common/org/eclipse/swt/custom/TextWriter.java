@@ -13,6 +13,8 @@
  *******************************************************************************/
 package org.eclipse.swt.custom;
 
+import java.io.*;
+
 import org.eclipse.swt.*;
 
 /**
@@ -24,9 +26,21 @@ import org.eclipse.swt.*;
  * <b>NOTE:</b> <code>toString()</code> is guaranteed to return a valid string only after close()
  * has been called.
  * </p>
+ * <p>
+ * A writer created with an output <code>Writer</code> streams its data instead:
+ * the data is passed on in chunks of about {@link #CHUNK_SIZE} characters and
+ * <code>toString()</code> only returns the part that has not been passed on yet.
+ * I/O errors are thrown as {@link UncheckedIOException}.
+ * </p>
  */
 class TextWriter {
+	/** The number of buffered characters after which a streaming writer passes them on */
+	static final int CHUNK_SIZE = 8192;
+
 	private StringBuilder buffer;
+	private Writer output;		// receives the data in chunks, null to keep it in the buffer
+	private char[] chunk;
+	private long count;			// number of characters passed on to the output
 	private int startOffset;	// offset of first character that will be written
 	private int endOffset;		// offset of last character that will be written.
 								// 0 based from the beginning of the widget text.
@@ -40,20 +54,75 @@ class TextWriter {
 	 * @param length length of content to write
 	 */
 	public TextWriter(int start, int length) {
-		buffer = new StringBuilder(length);
+		this(start, length, null);
+	}
+	/**
+	 * Creates a writer that writes content starting at offset "start"
+	 * in the document to the specified output.
+	 *
+	 * @param start start offset of content to write, 0 based from beginning of document
+	 * @param length length of content to write
+	 * @param output the writer that receives the data in chunks, or <code>null</code>
+	 *  to keep the data in memory
+	 */
+	TextWriter(int start, int length, Writer output) {
+		this.output = output;
+		if (output != null) {
+			buffer = new StringBuilder(CHUNK_SIZE * 2);
+			chunk = new char[CHUNK_SIZE * 2];
+		} else {
+			buffer = new StringBuilder(length);
+		}
 		startOffset = start;
 		endOffset = start + length;
 	}
 	/**
 	 * Closes the writer. Once closed no more content can be written.
+	 * A streaming writer passes the remaining data on to its output,
+	 * which is flushed but not closed.
 	 * <b>NOTE:</b>  <code>toString()</code> is not guaranteed to return a valid string unless
 	 * the writer is closed.
 	 */
 	public void close() {
 		if (!isClosed) {
+			if (output != null) {
+				flush();
+				try {
+					output.flush();
+				} catch (IOException e) {
+					throw new UncheckedIOException(e);
+				}
+			}
 			isClosed = true;
 		}
 	}
+	/**
+	 * Passes the buffered data on to the output.
+	 */
+	void flush() {
+		int length = buffer.length();
+		if (length == 0) return;
+		if (chunk.length < length) {
+			chunk = new char[length];
+		}
+		buffer.getChars(0, length, chunk, 0);
+		buffer.setLength(0);
+		try {
+			output.write(chunk, 0, length);
+		} catch (IOException e) {
+			throw new UncheckedIOException(e);
+		}
+		count += length;
+	}
+	/**
+	 * Returns the number of characters written so far, including the
+	 * ones that a streaming writer has passed on to its output.
+	 *
+	 * @return the number of characters written
+	 */
+	long getWrittenCount() {
+		return count + buffer.length();
+	}
 	/**
 	 * Returns the number of characters to write.
 	 * @return the integer number of characters to write
@@ -91,21 +160,15 @@ class TextWriter {
 	 */
 	void write(String string) {
 		buffer.append(string);
+		if (output != null && buffer.length() >= CHUNK_SIZE) flush();
 	}
 	/**
-	 * Inserts the given string to the data at the specified offset.
-	 * <p>
-	 * Do nothing if "offset" is &lt; 0 or &gt; getCharCount()
-	 * </p>
-	 *
-	 * @param string text to insert
-	 * @param offset offset in the existing data to insert "string" at.
+	 * Appends the segment of the given string from {@code start} up to,
+	 * but excluding, {@code end} to the data.
 	 */
-	void write(String string, int offset) {
-		if (offset < 0 || offset > buffer.length()) {
-			return;
-		}
-		buffer.insert(offset, string);
+	void write(String string, int start, int end) {
+		buffer.append(string, start, end);
+		if (output != null && buffer.length() >= CHUNK_SIZE) flush();
 	}
 	/**
 	 * Appends the given int to the data.
@@ -147,7 +210,7 @@ class TextWriter {
 		}
 		int copyEnd = Math.min(lineLength, endOffset - lineOffset);
 		if (lineIndex < copyEnd) {
-			write(line.substring(lineIndex, copyEnd));
+			write(line, lineIndex, copyEnd);
 		}
 	}
 	/**
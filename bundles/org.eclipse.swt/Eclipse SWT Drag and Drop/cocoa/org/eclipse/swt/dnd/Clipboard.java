@@ -15,6 +15,7 @@ package org.eclipse.swt.dnd;
 
 
 import org.eclipse.swt.*;
+import org.eclipse.swt.internal.DeferredContent;
 import org.eclipse.swt.internal.cocoa.*;
 import org.eclipse.swt.widgets.*;
 
@@ -441,7 +442,7 @@ public void setContents(Object[] data, Transfer[] dataTypes, int clipboards) {
 		DND.error(SWT.ERROR_INVALID_ARGUMENT);
 	}
 	for (int i = 0; i < data.length; i++) {
-		if (data[i] == null || dataTypes[i] == null || !dataTypes[i].validate(data[i])) {
+		if (data[i] == null || dataTypes[i] == null || !(data[i] instanceof DeferredContent || dataTypes[i].validate(data[i]))) {
 			DND.error(SWT.ERROR_INVALID_ARGUMENT);
 		}
 	}
@@ -452,11 +453,14 @@ public void setContents(Object[] data, Transfer[] dataTypes, int clipboards) {
 	}
 	pasteboard.declareTypes(NSMutableArray.arrayWithCapacity(0), null);
 	for (int i=0; i<dataTypes.length; i++) {
+		/* The pasteboard is written eagerly, so deferred content is computed now */
+		Object value = DeferredContent.resolve(data[i]);
+		if (value == null || !dataTypes[i].validate(value)) continue;
 		String[] typeNames = dataTypes[i].getTypeNames();
 		for (int j=0; j<typeNames.length; j++) {
 			TransferData transferData = new TransferData();
 			transferData.type = Transfer.registerType(typeNames[j]);
-			dataTypes[i].javaToNative(data[i], transferData);
+			dataTypes[i].javaToNative(value, transferData);
 			NSObject tdata = transferData.data;
 			NSString dataType = NSString.stringWith(typeNames[j]);
 			pasteboard.addTypes(NSArray.arrayWithObject(dataType), null);
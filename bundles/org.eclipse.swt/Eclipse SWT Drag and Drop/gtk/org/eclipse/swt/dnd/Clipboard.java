@@ -498,7 +498,7 @@ public void setContents(Object[] data, Transfer[] dataTypes, int clipboards) {
 		DND.error(SWT.ERROR_INVALID_ARGUMENT);
 	}
 	for (int i = 0; i < data.length; i++) {
-		if (data[i] == null || dataTypes[i] == null || !dataTypes[i].validate(data[i])) {
+		if (data[i] == null || dataTypes[i] == null || !(data[i] instanceof DeferredContent || dataTypes[i].validate(data[i]))) {
 			DND.error(SWT.ERROR_INVALID_ARGUMENT);
 		}
 	}
@@ -138,7 +138,9 @@ long getFunc(long clipboard, long selection_data, long info, long user_data_or_o
 	}
 	if (index == -1) return 0;
 	Object[] data = (clipboard == Clipboard.GTKCLIPBOARD) ? clipboardData : primaryClipboardData;
-	types[index].javaToNative(data[index], tdata);
+	Object value = DeferredContent.resolve(data[index]);
+	if (value == null || !types[index].validate(value)) return 0;
+	types[index].javaToNative(value, tdata);
 	if (tdata.format < 8 || tdata.format % 8 != 0) {
 		return 0;
 	}
@@ -226,8 +228,11 @@ private boolean setData_gtk4(Clipboard owner, Object[] data, Transfer[] dataType
 	for (int i = 0; i < dataTypes.length; i++) {
 		Transfer transfer = dataTypes[i];
 		String[] typeNames = transfer.getTypeNames();
+		/* GTK 4 content providers hold their value, so deferred content is computed now */
+		Object value = DeferredContent.resolve(data[i]);
+		if (value == null || !transfer.validate(value)) continue;
 		//Build the GdkContentProvider for each and store in array
-		long provider = setProviderFromType(typeNames[0], data[i]);
+		long provider = setProviderFromType(typeNames[0], value);
 		if(provider != 0) {
 			long[] tmp = new long [providers.length + 1];
 			System.arraycopy(providers, 0, tmp, 0, providers.length);
@@ -1,5 +1,5 @@
 /*******************************************************************************
- * Copyright (c) 2000, 2018 IBM Corporation and others.
+ * Copyright (c) 2000, 2026 IBM Corporation and others.
  *
  * This program and the accompanying materials
  * are made available under the terms of the Eclipse Public License 2.0
@@ -96,6 +96,28 @@ public class DropTarget extends Widget {
 	long dragOverStart;
 	Runnable dragOverHeartbeat;
 	DNDEvent dragOverEvent;
+	int dragOverX, dragOverY;
+
+	// Drag over events are not sent more than once per coalescing interval while the pointer stays over the same item
+	int dragOverCoalescing;
+	int lastDragOverTime;
+	Widget lastDragOverItem;
+
+	// The item under the pointer, which is reused while the pointer stays within the bounds of its row
+	Widget hitItem;
+	int hitLeft, hitTop, hitRight, hitBottom;
+	boolean hitValid;
+	long hitModel, hitAdjustment;
+	int row_inserted_handler;
+	int row_deleted_handler;
+	int rows_reordered_handler;
+	int row_expanded_handler;
+	int row_collapsed_handler;
+	int value_changed_handler;
+	Listener hitListener;
+
+	// Drag over statistics, see getDragOverStatistics()
+	long motionCount, dragOverCount, coalescedCount, hitTestCount, hitCacheHits;
 
 	int drag_motion_handler;
 	int drag_leave_handler;
@@ -105,17 +127,26 @@ public class DropTarget extends Widget {
 	static final String DEFAULT_DROP_TARGET_EFFECT = "DEFAULT_DROP_TARGET_EFFECT"; //$NON-NLS-1$
 	static final String IS_ACTIVE = "org.eclipse.swt.internal.control.isactive"; //$NON-NLS-1$
 	static final int DRAGOVER_HYSTERESIS = 50;
+	static final String DRAGOVER_COALESCING_KEY = "org.eclipse.swt.internal.gtk.dragOverCoalescing"; //$NON-NLS-1$
 
 	static Callback Drag_Motion;
 	static Callback Drag_Leave;
 	static Callback Drag_Data_Received;
 	static Callback Drag_Drop;
+	static Callback Items_Moved_2;
+	static Callback Items_Moved_3;
+	static Callback Items_Moved_4;
+	static Callback Items_Moved_5;
 
 	static {
 		Drag_Motion = new Callback(DropTarget.class, "Drag_Motion", 5); //$NON-NLS-1$
 		Drag_Leave = new Callback(DropTarget.class, "Drag_Leave", 3); //$NON-NLS-1$
 		Drag_Data_Received = new Callback(DropTarget.class, "Drag_Data_Received", 7); //$NON-NLS-1$
 		Drag_Drop = new Callback(DropTarget.class, "Drag_Drop", 5); //$NON-NLS-1$
+		Items_Moved_2 = new Callback(DropTarget.class, "Items_Moved", 2); //$NON-NLS-1$
+		Items_Moved_3 = new Callback(DropTarget.class, "Items_Moved", 3); //$NON-NLS-1$
+		Items_Moved_4 = new Callback(DropTarget.class, "Items_Moved", 4); //$NON-NLS-1$
+		Items_Moved_5 = new Callback(DropTarget.class, "Items_Moved", 5); //$NON-NLS-1$
 	}
 
 	/* GTK4 specific */
@@ -219,9 +250,7 @@ public DropTarget(Control control, int style) {
 				event.dataType = selectedDataType;
 				event.operations = dragOverEvent.operations;
 				event.detail  = selectedOperation;
-				if (dropEffect != null) {
-					event.item = dropEffect.getItem(dragOverEvent.x, dragOverEvent.y);
-				}
+				event.item = getItem(dragOverX, dragOverY, new Point(dragOverEvent.x, dragOverEvent.y), true);
 				selectedDataType = null;
 				selectedOperation = DND.DROP_NONE;
 				notifyListeners(DND.DragOver, event);
@@ -275,6 +304,29 @@ static long Drag_Motion ( long widget, long context, long x, long y, long time){
 	return target.drag_motion (widget, context, (int)x, (int)y, (int)time) ? 1 : 0;
 }
 
+/*
+ * Invoked when the rows of a table or tree move while a drag is over it, because
+ * items were inserted, removed, reordered, expanded or collapsed, or the rows were
+ * scrolled. The user data is the handle of the control.
+ */
+static long Items_Moved (long instance, long user_data) {
+	DropTarget target = FindDropTarget(user_data);
+	if (target != null) target.hitValid = false;
+	return 0;
+}
+
+static long Items_Moved (long model, long path, long user_data) {
+	return Items_Moved(model, user_data);
+}
+
+static long Items_Moved (long model, long path, long iter, long user_data) {
+	return Items_Moved(model, user_data);
+}
+
+static long Items_Moved (long model, long path, long iter, long new_order, long user_data) {
+	return Items_Moved(model, user_data);
+}
+
 static DropTarget FindDropTarget(long handle) {
 	Display display = Display.findDisplay(Thread.currentThread());
 	if (display == null || display.isDisposed()) return null;
@@ -425,7 +477,8 @@ boolean drag_drop(long widget, long context, int x, int y, int time) {
 }
 
 void drag_leave ( long widget, long context, int time){
-	updateDragOverHover(0, null);
+	updateDragOverHover(0, null, 0, 0);
+	unhookItemChanges();
 
 	if (keyOperation == -1) return;
 	keyOperation = -1;
@@ -451,29 +504,70 @@ boolean drag_motion ( long widget, long context, int x, int y, int time){
 	}
 
 	DNDEvent event = new DNDEvent();
-	if (!setEventData(context, x, y, time, event)) {
+	if (!setEventData(context, x, y, time, event, true)) {
 		keyOperation = -1;
 		GDK.gdk_drag_status(context, 0, time);
 		return false;
 	}
 
+	switch (dragMotion(event, x, y, oldKeyOperation)) {
+		case DND.DROP_NONE:
+			GDK.gdk_drag_status(context, 0, time);
+			break;
+		case DND.DROP_COPY:
+			GDK.gdk_drag_status(context, GDK.GDK_ACTION_COPY, time);
+			break;
+		case DND.DROP_MOVE:
+			GDK.gdk_drag_status(context, GDK.GDK_ACTION_MOVE, time);
+			break;
+		case DND.DROP_LINK:
+			GDK.gdk_drag_status(context, GDK.GDK_ACTION_LINK, time);
+			break;
+	}
+
+	if (oldKeyOperation == -1) {
+		dragOverHeartbeat.run();
+	}
+	return true;
+}
+
+/*
+ * Notifies the listeners of a pointer motion over the control and returns the
+ * selected operation. While the operation does not change and the pointer stays
+ * over the same item, drag over events are sent at most once per coalescing
+ * interval and the previous selection is reported to the drag source.
+ */
+int dragMotion(DNDEvent event, int x, int y, int oldKeyOperation) {
+	motionCount++;
 	int allowedOperations = event.operations;
 	TransferData[] allowedDataTypes = new TransferData[event.dataTypes.length];
 	System.arraycopy(event.dataTypes, 0, allowedDataTypes, 0, allowedDataTypes.length);
 
 	if (oldKeyOperation == -1) {
 		event.type = DND.DragEnter;
+		Object value = getData(DRAGOVER_COALESCING_KEY);
+		dragOverCoalescing = Math.max(0, value instanceof Integer ? ((Integer) value).intValue() : Integer.getInteger(DRAGOVER_COALESCING_KEY, 0));
+		hookItemChanges();
 	} else {
 		if (keyOperation == oldKeyOperation) {
 			event.type = DND.DragOver;
 			event.dataType = selectedDataType;
 			event.detail = selectedOperation;
+			int elapsed = event.time - lastDragOverTime;
+			if (dragOverCoalescing > 0 && event.item == lastDragOverItem && 0 <= elapsed && elapsed < dragOverCoalescing) {
+				coalescedCount++;
+				updateDragOverHover(DRAGOVER_HYSTERESIS, event, x, y);
+				return selectedOperation;
+			}
 		} else {
 			event.type = DND.DragOperationChanged;
 			event.dataType = selectedDataType;
 		}
 	}
-	updateDragOverHover(DRAGOVER_HYSTERESIS, event);
+	lastDragOverTime = event.time;
+	lastDragOverItem = event.item;
+	dragOverCount++;
+	updateDragOverHover(DRAGOVER_HYSTERESIS, event, x, y);
 	selectedDataType = null;
 	selectedOperation = DND.DROP_NONE;
 	notifyListeners(event.type, event);
@@ -491,26 +585,7 @@ boolean drag_motion ( long widget, long context, int x, int y, int time){
 	if (selectedDataType != null && (allowedOperations & event.detail) != 0) {
 		selectedOperation = event.detail;
 	}
-
-	switch (selectedOperation) {
-		case DND.DROP_NONE:
-			GDK.gdk_drag_status(context, 0, time);
-			break;
-		case DND.DROP_COPY:
-			GDK.gdk_drag_status(context, GDK.GDK_ACTION_COPY, time);
-			break;
-		case DND.DROP_MOVE:
-			GDK.gdk_drag_status(context, GDK.GDK_ACTION_MOVE, time);
-			break;
-		case DND.DROP_LINK:
-			GDK.gdk_drag_status(context, GDK.GDK_ACTION_LINK, time);
-			break;
-	}
-
-	if (oldKeyOperation == -1) {
-		dragOverHeartbeat.run();
-	}
-	return true;
+	return selectedOperation;
 }
 
 /**
@@ -574,6 +649,47 @@ public DropTargetEffect getDropTargetEffect() {
 	return dropEffect;
 }
 
+/*
+ * Returns {motions, drag over events, coalesced motions, item hit tests, cached items}
+ * since the drop target was created.
+ */
+long[] getDragOverStatistics() {
+	return new long[] {motionCount, dragOverCount, coalescedCount, hitTestCount, hitCacheHits};
+}
+
+/*
+ * Returns the item at the specified location. The x and y arguments are relative
+ * to the control's widget, the coordinates are relative to the display. The item of
+ * a pointer motion is reused while the pointer stays within the bounds of its row.
+ */
+Widget getItem(int x, int y, Point coordinates, boolean motion) {
+	if (dropEffect == null) return null;
+	if (motion && hitValid && hitLeft <= x && x < hitRight && hitTop <= y && y < hitBottom && !hitItem.isDisposed()) {
+		hitCacheHits++;
+		return hitItem;
+	}
+	hitTestCount++;
+	hitValid = false;
+	hitItem = null;
+	Widget item = dropEffect.getItem(coordinates.x, coordinates.y);
+	if (motion && item != null && hitModel != 0) {
+		Rectangle bounds = item instanceof TreeItem ? ((TreeItem) item).getBounds() : ((TableItem) item).getBounds();
+		Rectangle area = ((Scrollable) control).getClientArea();
+		Rectangle row = area.intersection(new Rectangle(area.x, bounds.y, area.width, bounds.height));
+		if (!row.isEmpty()) {
+			Point point = DPIUtil.autoScaleUp(control.toControl(coordinates));
+			row = DPIUtil.autoScaleUp(row);
+			hitLeft = row.x + x - point.x;
+			hitTop = row.y + y - point.y;
+			hitRight = hitLeft + row.width;
+			hitBottom = hitTop + row.height;
+			hitItem = item;
+			hitValid = hitLeft <= x && x < hitRight && hitTop <= y && y < hitBottom;
+		}
+	}
+	return item;
+}
+
 int getOperationFromKeyState() {
 	int[] state = new int[1];
 	long pointer = GDK.gdk_get_pointer (GDK.gdk_display_get_default());
@@ -605,6 +721,7 @@ public Transfer[] getTransfer() {
 
 void onDispose(){
 	if (control == null) return;
+	unhookItemChanges();
 	OS.g_signal_handler_disconnect(control.handle, drag_motion_handler);
 	OS.g_signal_handler_disconnect(control.handle, drag_leave_handler);
 	OS.g_signal_handler_disconnect(control.handle, drag_data_received_handler);
@@ -619,6 +736,55 @@ void onDispose(){
 	controlListener = null;
 }
 
+/*
+ * Invalidates the cached item whenever the rows of a table or tree move, while
+ * a drag is over it. Only the default drop target effects map every location
+ * of a row to its item, so the item is not cached for other effects.
+ */
+void hookItemChanges() {
+	if (hitModel != 0 || dropEffect == null) return;
+	Class<?> effectClass = dropEffect.getClass();
+	if (effectClass != TableDropTargetEffect.class && effectClass != TreeDropTargetEffect.class) return;
+	long handle = control.handle;
+	long [] model = new long [1];
+	OS.g_object_get(handle, OS.model, model, 0);
+	if (model[0] == 0) return;
+	hitModel = model[0];
+	row_inserted_handler = OS.g_signal_connect(hitModel, OS.row_inserted, Items_Moved_4.getAddress(), handle);
+	row_deleted_handler = OS.g_signal_connect(hitModel, OS.row_deleted, Items_Moved_3.getAddress(), handle);
+	rows_reordered_handler = OS.g_signal_connect(hitModel, OS.rows_reordered, Items_Moved_5.getAddress(), handle);
+	row_expanded_handler = OS.g_signal_connect(handle, OS.row_expanded, Items_Moved_4.getAddress(), handle);
+	row_collapsed_handler = OS.g_signal_connect(handle, OS.row_collapsed, Items_Moved_4.getAddress(), handle);
+	hitAdjustment = GTK.gtk_scrollable_get_vadjustment(handle);
+	if (hitAdjustment != 0) {
+		OS.g_object_ref(hitAdjustment);
+		value_changed_handler = OS.g_signal_connect(hitAdjustment, OS.value_changed, Items_Moved_2.getAddress(), handle);
+	}
+	hitListener = event -> hitValid = false;
+	control.addListener(SWT.Resize, hitListener);
+}
+
+void unhookItemChanges() {
+	hitValid = false;
+	hitItem = null;
+	lastDragOverItem = null;
+	if (hitModel == 0) return;
+	long handle = control.handle;
+	OS.g_signal_handler_disconnect(hitModel, row_inserted_handler);
+	OS.g_signal_handler_disconnect(hitModel, row_deleted_handler);
+	OS.g_signal_handler_disconnect(hitModel, rows_reordered_handler);
+	OS.g_signal_handler_disconnect(handle, row_expanded_handler);
+	OS.g_signal_handler_disconnect(handle, row_collapsed_handler);
+	OS.g_object_unref(hitModel);
+	if (hitAdjustment != 0) {
+		OS.g_signal_handler_disconnect(hitAdjustment, value_changed_handler);
+		OS.g_object_unref(hitAdjustment);
+	}
+	if (!control.isDisposed()) control.removeListener(SWT.Resize, hitListener);
+	hitModel = hitAdjustment = 0;
+	hitListener = null;
+}
+
 int opToOsOp(int operation){
 	int osOperation = 0;
 	if ((operation & DND.DROP_COPY) == DND.DROP_COPY)
@@ -754,9 +920,14 @@ public void setTransfer(Transfer... transferAgents){
  */
 public void setDropTargetEffect(DropTargetEffect effect) {
 	dropEffect = effect;
+	hitValid = false;
 }
 
 boolean setEventData(long context, int x, int y, int time, DNDEvent event) {
+	return setEventData(context, x, y, time, event, false);
+}
+
+boolean setEventData(long context, int x, int y, int time, DNDEvent event, boolean motion) {
 	if (context == 0) return false;
 	long targets = GDK.gdk_drag_context_list_targets(context);
 	int actions = GDK.gdk_drag_context_get_actions(context);
@@ -767,17 +938,6 @@ boolean setEventData(long context, int x, int y, int time, DNDEvent event) {
 	int operations = osOpToOp(actions) & style;
 	if (operations == DND.DROP_NONE) return false;
 
-	// get current operation
-	int operation = getOperationFromKeyState();
-	keyOperation = operation;
-	if (operation == DND.DROP_DEFAULT) {
-		if ((style & DND.DROP_DEFAULT) == 0) {
-			operation = (operations & DND.DROP_MOVE) != 0 ? DND.DROP_MOVE : DND.DROP_NONE;
-		}
-	} else {
-		if ((operation & operations) == 0) operation = DND.DROP_NONE;
-	}
-
 	// Get allowed transfer types
 	TransferData[] dataTypes = new TransferData[0];
 	while (targets != 0) {
@@ -797,6 +957,26 @@ boolean setEventData(long context, int x, int y, int time, DNDEvent event) {
 		targets = OS.g_list_next (targets);
 	}
 	if (dataTypes.length == 0) return false;
+	setEventData(x, y, time, operations, getOperationFromKeyState(), dataTypes, event, motion);
+	return true;
+}
+
+/*
+ * Fills in the event for a location relative to the control's widget, given the allowed
+ * operations and transfer types of the drag and the operation selected by the key state.
+ */
+void setEventData(int x, int y, int time, int operations, int operation, TransferData[] dataTypes, DNDEvent event, boolean motion) {
+	// get current operation
+	int style = getStyle();
+	keyOperation = operation;
+	if (operation == DND.DROP_DEFAULT) {
+		if ((style & DND.DROP_DEFAULT) == 0) {
+			operation = (operations & DND.DROP_MOVE) != 0 ? DND.DROP_MOVE : DND.DROP_NONE;
+		}
+	} else {
+		if ((operation & operations) == 0) operation = DND.DROP_NONE;
+	}
+
 	int [] origin_x = new int[1], origin_y = new int[1];
 	if (GTK.GTK4) {
 		// TODO: GTK4 no gdk_surface_get_origin
@@ -815,13 +995,10 @@ boolean setEventData(long context, int x, int y, int time, DNDEvent event) {
 	event.dataType = dataTypes[0];
 	event.operations = operations;
 	event.detail = operation;
-	if (dropEffect != null) {
-		event.item = dropEffect.getItem(coordinates.x, coordinates.y);
-	}
-	return true;
+	event.item = getItem(x, y, coordinates, motion);
 }
 
-void updateDragOverHover(long delay, DNDEvent event) {
+void updateDragOverHover(long delay, DNDEvent event, int x, int y) {
 	if (delay == 0) {
 		dragOverStart = 0;
 		dragOverEvent = null;
@@ -829,6 +1006,8 @@ void updateDragOverHover(long delay, DNDEvent event) {
 	}
 	dragOverStart = System.currentTimeMillis() + delay;
 	if (dragOverEvent == null) dragOverEvent = new DNDEvent();
+	dragOverX = x;
+	dragOverY = y;
 	dragOverEvent.x = event.x;
 	dragOverEvent.y = event.y;
 	TransferData[] dataTypes = new TransferData[ event.dataTypes.length];
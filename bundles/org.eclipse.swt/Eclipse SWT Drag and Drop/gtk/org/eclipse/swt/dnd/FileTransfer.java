@@ -1,5 +1,5 @@
 /*******************************************************************************
- * Copyright (c) 2000, 2017 IBM Corporation and others.
+ * Copyright (c) 2000, 2026 IBM Corporation and others.
  *
  * This program and the accompanying materials
  * are made available under the terms of the Eclipse Public License 2.0
@@ -74,53 +74,23 @@ public void javaToNative(Object object, TransferData transferData) {
 		DND.error(DND.ERROR_INVALID_DATA);
 	}
 	boolean gnomeList = transferData.type == GNOME_LIST_ID;
-	byte[] buffer, separator;
-	if (gnomeList) {
-		buffer = new byte[] {'c','o','p','y'};
-		separator = new byte[] {'\n'};
-	} else {
-		buffer = new byte[0];
-		separator = new byte[] {'\r', '\n'};
-	}
+	/* The file names are converted to URIs by a single native call, separated by nul characters */
 	String[] files = (String[])object;
+	int length = 0;
+	for (int i = 0; i < files.length; i++) {
+		length += files[i].length() + 1;
+	}
+	char[] names = new char[length];
+	int offset = 0;
 	for (int i = 0; i < files.length; i++) {
 		String string = files[i];
-		if (string == null) continue;
-		int length = string.length();
-		if (length == 0) continue;
-		char[] chars = new char[length];
-		string.getChars(0, length, chars, 0);
-		long [] error = new long [1];
-		long utf8Ptr = OS.g_utf16_to_utf8(chars, chars.length, null, null, error);
-		if (error[0] != 0 || utf8Ptr == 0) continue;
-		long localePtr = OS.g_filename_from_utf8(utf8Ptr, -1, null, null, error);
-		OS.g_free(utf8Ptr);
-		if (error[0] != 0 || localePtr == 0) continue;
-		long uriPtr = OS.g_filename_to_uri(localePtr, 0, error);
-		OS.g_free(localePtr);
-		if (error[0] != 0 || uriPtr == 0) continue;
-		length = C.strlen(uriPtr);
-		byte[] temp = new byte[length];
-		C.memmove (temp, uriPtr, length);
-		OS.g_free(uriPtr);
-		int newLength = (buffer.length > 0) ? buffer.length+separator.length+temp.length :  temp.length;
-		byte[] newBuffer = new byte[newLength];
-		int offset = 0;
-		if (buffer.length > 0) {
-			System.arraycopy(buffer, 0, newBuffer, 0, buffer.length);
-			offset +=  buffer.length;
-			System.arraycopy(separator, 0, newBuffer, offset, separator.length);
-			offset += separator.length;
-		}
-		System.arraycopy(temp, 0, newBuffer, offset, temp.length);
-		buffer = newBuffer;
+		string.getChars(0, string.length(), names, offset);
+		offset += string.length() + 1;
 	}
-	if (buffer.length == 0) return;
-	long ptr = OS.g_malloc(buffer.length+1);
-	C.memset(ptr, '\0', buffer.length+1);
-	C.memmove(ptr, buffer, buffer.length);
+	long ptr = OS.swt_uri_list_encode(names, names.length, gnomeList);
+	if (ptr == 0) return;
 	transferData.pValue = ptr;
-	transferData.length = buffer.length;
+	transferData.length = C.strlen(ptr);
 	transferData.format = 8;
 	transferData.result = 1;
 }
@@ -138,67 +108,25 @@ public void javaToNative(Object object, TransferData transferData) {
 @Override
 public Object nativeToJava(TransferData transferData) {
 	if ( !isSupportedType(transferData) ||  transferData.pValue == 0 ||  transferData.length <= 0 ) return null;
-	int length = transferData.length;
-	byte[] temp = new byte[length];
-	C.memmove(temp, transferData.pValue, length);
 	boolean gnomeList = transferData.type == GNOME_LIST_ID;
-	int sepLength = gnomeList ? 1 : 2;
-	long [] files = new long [0];
-	int offset = 0;
-	for (int i = 0; i < temp.length - 1; i++) {
-		boolean terminator = gnomeList ? temp[i] == '\n' : temp[i] == '\r' && temp[i+1] == '\n';
-		if (terminator) {
-			if (!(gnomeList && offset == 0)) {
-				/* The content of the first line in a gnome-list is always either 'copy' or 'cut' */
-				int size =  i - offset;
-				long file = OS.g_malloc(size + 1);
-				byte[] fileBuffer = new byte[size + 1];
-				System.arraycopy(temp, offset, fileBuffer, 0, size);
-				C.memmove(file, fileBuffer, size + 1);
-				long [] newFiles = new long [files.length + 1];
-				System.arraycopy(files, 0, newFiles, 0, files.length);
-				newFiles[files.length] = file;
-				files = newFiles;
-			}
-			offset = i + sepLength;
-		}
-	}
-	if (offset < temp.length - sepLength) {
-		int size =  temp.length - offset;
-		long file = OS.g_malloc(size + 1);
-		byte[] fileBuffer = new byte[size + 1];
-		System.arraycopy(temp, offset, fileBuffer, 0, size);
-		C.memmove(file, fileBuffer, size + 1);
-		long [] newFiles = new long [files.length + 1];
-		System.arraycopy(files, 0, newFiles, 0, files.length);
-		newFiles[files.length] = file;
-		files = newFiles;
+	long [] items_written = new long [1];
+	long utf16Ptr = OS.swt_uri_list_decode(transferData.pValue, transferData.length, gnomeList, items_written);
+	if (utf16Ptr == 0) return null;
+	char[] names = new char[(int)items_written[0]];
+	C.memmove(names, utf16Ptr, names.length * 2);
+	OS.g_free(utf16Ptr);
+	int count = 1;
+	for (int i = 0; i < names.length; i++) {
+		if (names[i] == 0) count++;
 	}
-	String[] fileNames = new String[0];
-	for (int i = 0; i < files.length; i++) {
-		long [] error = new long [1];
-		long localePtr = OS.g_filename_from_uri(files[i], null, error);
-		OS.g_free(files[i]);
-		if (error[0] != 0 || localePtr == 0) continue;
-		long utf8Ptr = OS.g_filename_to_utf8(localePtr, -1, null, null, null);
-		if (utf8Ptr == 0) utf8Ptr = OS.g_filename_display_name (localePtr);
-		if (localePtr != utf8Ptr) OS.g_free (localePtr);
-		if (utf8Ptr == 0) continue;
-		long [] items_written = new long [1];
-		long utf16Ptr = OS.g_utf8_to_utf16(utf8Ptr, -1, null, items_written, null);
-		OS.g_free(utf8Ptr);
-		if (utf16Ptr == 0) continue;
-		length = (int)items_written[0];
-		char[] buffer = new char[length];
-		C.memmove(buffer, utf16Ptr, length * 2);
-		OS.g_free(utf16Ptr);
-		String name = new String(buffer);
-		String[] newFileNames = new String[fileNames.length + 1];
-		System.arraycopy(fileNames, 0, newFileNames, 0, fileNames.length);
-		newFileNames[fileNames.length] = name;
-		fileNames = newFileNames;
+	String[] fileNames = new String[count];
+	int start = 0, index = 0;
+	for (int i = 0; i <= names.length; i++) {
+		if (i == names.length || names[i] == 0) {
+			fileNames[index++] = new String(names, start, i - start);
+			start = i + 1;
+		}
 	}
-	if (fileNames.length == 0) return null;
 	return fileNames;
 }
 
@@ -500,7 +500,7 @@ public void setContents(Object[] data, Transfer[] dataTypes, int clipboards) {
 		DND.error(SWT.ERROR_INVALID_ARGUMENT);
 	}
 	for (int i = 0; i < data.length; i++) {
-		if (data[i] == null || dataTypes[i] == null || !dataTypes[i].validate(data[i])) {
+		if (data[i] == null || dataTypes[i] == null || !(data[i] instanceof DeferredContent || dataTypes[i].validate(data[i]))) {
 			DND.error(SWT.ERROR_INVALID_ARGUMENT);
 		}
 	}
@@ -637,7 +637,9 @@ private int GetData(long pFormatetc, long pmedium) {
 		}
 	}
 	if (transferIndex == -1) return COM.DV_E_FORMATETC;
-	transferAgents[transferIndex].javaToNative(data[transferIndex], transferData);
+	Object value = DeferredContent.resolve(data[transferIndex]);
+	if (value == null || !transferAgents[transferIndex].validate(value)) return COM.DV_E_FORMATETC;
+	transferAgents[transferIndex].javaToNative(value, transferData);
 	COM.MoveMemory(pmedium, transferData.stgmedium, STGMEDIUM.sizeof);
 	return transferData.result;
 }
@@ -704,6 +704,26 @@ fail:
 }
 #endif
 
+#ifndef NO_cairo_1pdf_1surface_1create_1for_1stream
+JNIEXPORT jlong JNICALL Cairo_NATIVE(cairo_1pdf_1surface_1create_1for_1stream)
+	(JNIEnv *env, jclass that, jlong arg0, jlong arg1, jdouble arg2, jdouble arg3)
+{
+	jlong rc = 0;
+	Cairo_NATIVE_ENTER(env, that, cairo_1pdf_1surface_1create_1for_1stream_FUNC);
+/*
+	rc = (jlong)cairo_pdf_surface_create_for_stream((cairo_write_func_t)arg0, (void *)arg1, arg2, arg3);
+*/
+	{
+		Cairo_LOAD_FUNCTION(fp, cairo_pdf_surface_create_for_stream)
+		if (fp) {
+			rc = (jlong)((jlong (CALLING_CONVENTION*)(cairo_write_func_t, void *, jdouble, jdouble))fp)((cairo_write_func_t)arg0, (void *)arg1, arg2, arg3);
+		}
+	}
+	Cairo_NATIVE_EXIT(env, that, cairo_1pdf_1surface_1create_1for_1stream_FUNC);
+	return rc;
+}
+#endif
+
 #ifndef NO_cairo_1pdf_1surface_1set_1size
 JNIEXPORT void JNICALL Cairo_NATIVE(cairo_1pdf_1surface_1set_1size)
 	(JNIEnv *env, jclass that, jlong arg0, jdouble arg1, jdouble arg2)
@@ -732,6 +752,26 @@ JNIEXPORT void JNICALL Cairo_NATIVE(cairo_1pop_1group_1to_1source)
 }
 #endif
 
+#ifndef NO_cairo_1ps_1surface_1create_1for_1stream
+JNIEXPORT jlong JNICALL Cairo_NATIVE(cairo_1ps_1surface_1create_1for_1stream)
+	(JNIEnv *env, jclass that, jlong arg0, jlong arg1, jdouble arg2, jdouble arg3)
+{
+	jlong rc = 0;
+	Cairo_NATIVE_ENTER(env, that, cairo_1ps_1surface_1create_1for_1stream_FUNC);
+/*
+	rc = (jlong)cairo_ps_surface_create_for_stream((cairo_write_func_t)arg0, (void *)arg1, arg2, arg3);
+*/
+	{
+		Cairo_LOAD_FUNCTION(fp, cairo_ps_surface_create_for_stream)
+		if (fp) {
+			rc = (jlong)((jlong (CALLING_CONVENTION*)(cairo_write_func_t, void *, jdouble, jdouble))fp)((cairo_write_func_t)arg0, (void *)arg1, arg2, arg3);
+		}
+	}
+	Cairo_NATIVE_EXIT(env, that, cairo_1ps_1surface_1create_1for_1stream_FUNC);
+	return rc;
+}
+#endif
+
 #ifndef NO_cairo_1ps_1surface_1set_1size
 JNIEXPORT void JNICALL Cairo_NATIVE(cairo_1ps_1surface_1set_1size)
 	(JNIEnv *env, jclass that, jlong arg0, jdouble arg1, jdouble arg2)
@@ -862,6 +902,22 @@ fail:
 }
 #endif
 
+#ifndef NO_cairo_1region_1create_1rectangles
+JNIEXPORT jlong JNICALL Cairo_NATIVE(cairo_1region_1create_1rectangles)
+	(JNIEnv *env, jclass that, jintArray arg0, jint arg1)
+{
+	jint *lparg0=NULL;
+	jlong rc = 0;
+	Cairo_NATIVE_ENTER(env, that, cairo_1region_1create_1rectangles_FUNC);
+		if (arg0) if ((lparg0 = (*env)->GetPrimitiveArrayCritical(env, arg0, NULL)) == NULL) goto fail;
+	rc = (jlong)cairo_region_create_rectangles((const cairo_rectangle_int_t *)lparg0, arg1);
+fail:
+		if (arg0 && lparg0) (*env)->ReleasePrimitiveArrayCritical(env, arg0, lparg0, JNI_ABORT);
+	Cairo_NATIVE_EXIT(env, that, cairo_1region_1create_1rectangles_FUNC);
+	return rc;
+}
+#endif
+
 #ifndef NO_cairo_1region_1destroy
 JNIEXPORT void JNICALL Cairo_NATIVE(cairo_1region_1destroy)
 	(JNIEnv *env, jclass that, jlong arg0)
@@ -1322,6 +1378,38 @@ JNIEXPORT void JNICALL Cairo_NATIVE(cairo_1surface_1set_1device_1scale)
 }
 #endif
 
+#ifndef NO_cairo_1surface_1status
+JNIEXPORT jint JNICALL Cairo_NATIVE(cairo_1surface_1status)
+	(JNIEnv *env, jclass that, jlong arg0)
+{
+	jint rc = 0;
+	Cairo_NATIVE_ENTER(env, that, cairo_1surface_1status_FUNC);
+	rc = (jint)cairo_surface_status((cairo_surface_t *)arg0);
+	Cairo_NATIVE_EXIT(env, that, cairo_1surface_1status_FUNC);
+	return rc;
+}
+#endif
+
+#ifndef NO_cairo_1svg_1surface_1create_1for_1stream
+JNIEXPORT jlong JNICALL Cairo_NATIVE(cairo_1svg_1surface_1create_1for_1stream)
+	(JNIEnv *env, jclass that, jlong arg0, jlong arg1, jdouble arg2, jdouble arg3)
+{
+	jlong rc = 0;
+	Cairo_NATIVE_ENTER(env, that, cairo_1svg_1surface_1create_1for_1stream_FUNC);
+/*
+	rc = (jlong)cairo_svg_surface_create_for_stream((cairo_write_func_t)arg0, (void *)arg1, arg2, arg3);
+*/
+	{
+		Cairo_LOAD_FUNCTION(fp, cairo_svg_surface_create_for_stream)
+		if (fp) {
+			rc = (jlong)((jlong (CALLING_CONVENTION*)(cairo_write_func_t, void *, jdouble, jdouble))fp)((cairo_write_func_t)arg0, (void *)arg1, arg2, arg3);
+		}
+	}
+	Cairo_NATIVE_EXIT(env, that, cairo_1svg_1surface_1create_1for_1stream_FUNC);
+	return rc;
+}
+#endif
+
 #ifndef NO_cairo_1transform
 JNIEXPORT void JNICALL Cairo_NATIVE(cairo_1transform)
 	(JNIEnv *env, jclass that, jlong arg0, jdoubleArray arg1)
@@ -84,8 +84,10 @@ char * Cairo_nativeFunctionNames[] = {
 	"cairo_1pattern_1set_1extend",
 	"cairo_1pattern_1set_1filter",
 	"cairo_1pattern_1set_1matrix",
+	"cairo_1pdf_1surface_1create_1for_1stream",
 	"cairo_1pdf_1surface_1set_1size",
 	"cairo_1pop_1group_1to_1source",
+	"cairo_1ps_1surface_1create_1for_1stream",
 	"cairo_1ps_1surface_1set_1size",
 	"cairo_1push_1group",
 	"cairo_1rectangle",
@@ -96,6 +98,7 @@ char * Cairo_nativeFunctionNames[] = {
 	"cairo_1region_1copy",
 	"cairo_1region_1create",
 	"cairo_1region_1create_1rectangle",
+	"cairo_1region_1create_1rectangles",
 	"cairo_1region_1destroy",
 	"cairo_1region_1get_1extents",
 	"cairo_1region_1get_1rectangle",
@@ -137,6 +140,8 @@ char * Cairo_nativeFunctionNames[] = {
 	"cairo_1surface_1mark_1dirty",
 	"cairo_1surface_1reference",
 	"cairo_1surface_1set_1device_1scale",
+	"cairo_1surface_1status",
+	"cairo_1svg_1surface_1create_1for_1stream",
 	"cairo_1transform",
 	"cairo_1translate",
 	"cairo_1user_1to_1device_1distance",
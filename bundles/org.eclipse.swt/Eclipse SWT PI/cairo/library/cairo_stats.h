@@ -94,8 +94,10 @@ typedef enum {
 	cairo_1pattern_1set_1extend_FUNC,
 	cairo_1pattern_1set_1filter_FUNC,
 	cairo_1pattern_1set_1matrix_FUNC,
+	cairo_1pdf_1surface_1create_1for_1stream_FUNC,
 	cairo_1pdf_1surface_1set_1size_FUNC,
 	cairo_1pop_1group_1to_1source_FUNC,
+	cairo_1ps_1surface_1create_1for_1stream_FUNC,
 	cairo_1ps_1surface_1set_1size_FUNC,
 	cairo_1push_1group_FUNC,
 	cairo_1rectangle_FUNC,
@@ -106,6 +108,7 @@ typedef enum {
 	cairo_1region_1copy_FUNC,
 	cairo_1region_1create_FUNC,
 	cairo_1region_1create_1rectangle_FUNC,
+	cairo_1region_1create_1rectangles_FUNC,
 	cairo_1region_1destroy_FUNC,
 	cairo_1region_1get_1extents_FUNC,
 	cairo_1region_1get_1rectangle_FUNC,
@@ -147,6 +150,8 @@ typedef enum {
 	cairo_1surface_1mark_1dirty_FUNC,
 	cairo_1surface_1reference_FUNC,
 	cairo_1surface_1set_1device_1scale_FUNC,
+	cairo_1surface_1status_FUNC,
+	cairo_1svg_1surface_1create_1for_1stream_FUNC,
 	cairo_1transform_FUNC,
 	cairo_1translate_FUNC,
 	cairo_1user_1to_1device_1distance_FUNC,
@@ -60,6 +60,9 @@ public class Cairo extends Platform {
 	public static final int CAIRO_SURFACE_TYPE_PDF = 1;
 	public static final int CAIRO_SURFACE_TYPE_PS = 2;
 	public static final int CAIRO_SURFACE_TYPE_XLIB = 3;
+	public static final int CAIRO_SURFACE_TYPE_SVG = 10;
+	public static final int CAIRO_STATUS_SUCCESS = 0;
+	public static final int CAIRO_STATUS_WRITE_ERROR = 11;
 	public static final int CAIRO_REGION_OVERLAP_OUT = 1;
 	public static final int CAIRO_FILTER_FAST = 0;
 	public static final int CAIRO_FILTER_GOOD = 1;
@@ -205,6 +208,12 @@ public static final native void cairo_pattern_set_filter(long pattern, int filte
  * @param matrix cast=(cairo_matrix_t *)
  */
 public static final native void cairo_pattern_set_matrix(long pattern, double[] matrix);
+/**
+ * @method flags=dynamic
+ * @param write_func cast=(cairo_write_func_t)
+ * @param closure cast=(void *)
+ */
+public static final native long cairo_pdf_surface_create_for_stream(long write_func, long closure, double width_in_points, double height_in_points);
 /**
  * @method flags=dynamic
  * @param surface cast=(cairo_surface_t *)
@@ -218,6 +227,12 @@ public static final native void cairo_push_group(long cairo);
  * @param cairo cast=(cairo_t *)
  */
 public static final native void cairo_pop_group_to_source(long cairo);
+/**
+ * @method flags=dynamic
+ * @param write_func cast=(cairo_write_func_t)
+ * @param closure cast=(void *)
+ */
+public static final native long cairo_ps_surface_create_for_stream(long write_func, long closure, double width_in_points, double height_in_points);
 /**
  * @method flags=dynamic
  * @param surface cast=(cairo_surface_t *)
@@ -313,6 +328,14 @@ public static final native int cairo_surface_get_content(long surface);
 public static final native void cairo_surface_mark_dirty(long surface);
 /** @param surface cast=(cairo_surface_t *) */
 public static final native void cairo_surface_reference(long surface);
+/** @param surface cast=(cairo_surface_t *) */
+public static final native int cairo_surface_status(long surface);
+/**
+ * @method flags=dynamic
+ * @param write_func cast=(cairo_write_func_t)
+ * @param closure cast=(void *)
+ */
+public static final native long cairo_svg_surface_create_for_stream(long write_func, long closure, double width_in_points, double height_in_points);
 /**
  * @param cr cast=(cairo_t *)
  * @param matrix cast=(cairo_matrix_t *)
@@ -374,6 +397,10 @@ public static final native void cairo_region_intersect(long source1, long source
  * @param rectangle cast=(const cairo_rectangle_int_t *)
  */
 public static final native long cairo_region_create_rectangle(cairo_rectangle_int_t rectangle);
+/**
+ * @param rects cast=(const cairo_rectangle_int_t *),flags=no_out critical
+ */
+public static final native long cairo_region_create_rectangles(int[] rects, int count);
 /**
  * @param source1 cast=(cairo_region_t *)
  * @param source2 cast=(const cairo_region_t *)
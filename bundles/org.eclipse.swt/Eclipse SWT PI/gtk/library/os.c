@@ -14967,6 +14967,22 @@ fail:
 }
 #endif
 
+#ifndef NO_swt_1app_1info_1marshal
+JNIEXPORT jlong JNICALL OS_NATIVE(swt_1app_1info_1marshal)
+	(JNIEnv *env, jclass that, jlong arg0, jlongArray arg1)
+{
+	jlong *lparg1=NULL;
+	jlong rc = 0;
+	OS_NATIVE_ENTER(env, that, swt_1app_1info_1marshal_FUNC);
+	if (arg1) if ((lparg1 = (*env)->GetLongArrayElements(env, arg1, NULL)) == NULL) goto fail;
+	rc = (jlong)swt_app_info_marshal((GList *)arg0, (glong *)lparg1);
+fail:
+	if (arg1 && lparg1) (*env)->ReleaseLongArrayElements(env, arg1, lparg1, 0);
+	OS_NATIVE_EXIT(env, that, swt_1app_1info_1marshal_FUNC);
+	return rc;
+}
+#endif
+
 #ifndef NO_swt_1debug_1on_1fatal_1warnings
 JNIEXPORT void JNICALL OS_NATIVE(swt_1debug_1on_1fatal_1warnings)
 	(JNIEnv *env, jclass that)
@@ -15061,6 +15077,26 @@ JNIEXPORT void JNICALL OS_NATIVE(swt_1fixed_1restack)
 }
 #endif
 
+#ifndef NO_swt_1list_1store_1set_1texts
+JNIEXPORT void JNICALL OS_NATIVE(swt_1list_1store_1set_1texts)
+	(JNIEnv *env, jclass that, jlong arg0, jlong arg1, jintArray arg2, jcharArray arg3, jintArray arg4, jint arg5)
+{
+	jint *lparg2=NULL;
+	jchar *lparg3=NULL;
+	jint *lparg4=NULL;
+	OS_NATIVE_ENTER(env, that, swt_1list_1store_1set_1texts_FUNC);
+	if (arg2) if ((lparg2 = (*env)->GetIntArrayElements(env, arg2, NULL)) == NULL) goto fail;
+	if (arg3) if ((lparg3 = (*env)->GetCharArrayElements(env, arg3, NULL)) == NULL) goto fail;
+	if (arg4) if ((lparg4 = (*env)->GetIntArrayElements(env, arg4, NULL)) == NULL) goto fail;
+	swt_list_store_set_texts((GtkListStore *)arg0, (GtkTreeIter *)arg1, (const gint *)lparg2, (const gunichar2 *)lparg3, (const gint *)lparg4, (gint)arg5);
+fail:
+	if (arg4 && lparg4) (*env)->ReleaseIntArrayElements(env, arg4, lparg4, JNI_ABORT);
+	if (arg3 && lparg3) (*env)->ReleaseCharArrayElements(env, arg3, lparg3, JNI_ABORT);
+	if (arg2 && lparg2) (*env)->ReleaseIntArrayElements(env, arg2, lparg2, JNI_ABORT);
+	OS_NATIVE_EXIT(env, that, swt_1list_1store_1set_1texts_FUNC);
+}
+#endif
+
 #ifndef NO_swt_1set_1lock_1functions
 JNIEXPORT void JNICALL OS_NATIVE(swt_1set_1lock_1functions)
 	(JNIEnv *env, jclass that)
@@ -15071,6 +15107,54 @@ JNIEXPORT void JNICALL OS_NATIVE(swt_1set_1lock_1functions)
 }
 #endif
 
+#ifndef NO_swt_1tree_1model_1get_1child_1ids
+JNIEXPORT jint JNICALL OS_NATIVE(swt_1tree_1model_1get_1child_1ids)
+	(JNIEnv *env, jclass that, jlong arg0, jlong arg1, jint arg2, jintArray arg3, jint arg4)
+{
+	jint *lparg3=NULL;
+	jint rc = 0;
+	OS_NATIVE_ENTER(env, that, swt_1tree_1model_1get_1child_1ids_FUNC);
+	if (arg3) if ((lparg3 = (*env)->GetIntArrayElements(env, arg3, NULL)) == NULL) goto fail;
+	rc = (jint)swt_tree_model_get_child_ids((GtkTreeModel *)arg0, (GtkTreeIter *)arg1, (gint)arg2, (gint *)lparg3, (gint)arg4);
+fail:
+	if (arg3 && lparg3) (*env)->ReleaseIntArrayElements(env, arg3, lparg3, 0);
+	OS_NATIVE_EXIT(env, that, swt_1tree_1model_1get_1child_1ids_FUNC);
+	return rc;
+}
+#endif
+
+#ifndef NO_swt_1uri_1list_1decode
+JNIEXPORT jlong JNICALL OS_NATIVE(swt_1uri_1list_1decode)
+	(JNIEnv *env, jclass that, jlong arg0, jlong arg1, jboolean arg2, jlongArray arg3)
+{
+	jlong *lparg3=NULL;
+	jlong rc = 0;
+	OS_NATIVE_ENTER(env, that, swt_1uri_1list_1decode_FUNC);
+	if (arg3) if ((lparg3 = (*env)->GetLongArrayElements(env, arg3, NULL)) == NULL) goto fail;
+	rc = (jlong)swt_uri_list_decode((const gchar *)arg0, (glong)arg1, (gboolean)arg2, (glong *)lparg3);
+fail:
+	if (arg3 && lparg3) (*env)->ReleaseLongArrayElements(env, arg3, lparg3, 0);
+	OS_NATIVE_EXIT(env, that, swt_1uri_1list_1decode_FUNC);
+	return rc;
+}
+#endif
+
+#ifndef NO_swt_1uri_1list_1encode
+JNIEXPORT jlong JNICALL OS_NATIVE(swt_1uri_1list_1encode)
+	(JNIEnv *env, jclass that, jcharArray arg0, jlong arg1, jboolean arg2)
+{
+	jchar *lparg0=NULL;
+	jlong rc = 0;
+	OS_NATIVE_ENTER(env, that, swt_1uri_1list_1encode_FUNC);
+	if (arg0) if ((lparg0 = (*env)->GetCharArrayElements(env, arg0, NULL)) == NULL) goto fail;
+	rc = (jlong)swt_uri_list_encode((const gunichar2 *)lparg0, (glong)arg1, (gboolean)arg2);
+fail:
+	if (arg0 && lparg0) (*env)->ReleaseCharArrayElements(env, arg0, lparg0, JNI_ABORT);
+	OS_NATIVE_EXIT(env, that, swt_1uri_1list_1encode_FUNC);
+	return rc;
+}
+#endif
+
 #ifndef NO_ubuntu_1menu_1proxy_1get
 JNIEXPORT jlong JNICALL OS_NATIVE(ubuntu_1menu_1proxy_1get)
 	(JNIEnv *env, jclass that)
@@ -225,6 +225,155 @@ glong g_utf8_offset_to_utf16_offset(const gchar* str, glong offset) {
 	return r;
 }
 
+/*
+ * Converts file names, separated by nul characters, to the URIs of a
+ * text/uri-list, or of an x-special/gnome-copied-files list when gnome_list
+ * is set. Names that cannot be converted are skipped. Returns NULL if no
+ * name could be converted.
+ */
+gchar* swt_uri_list_encode(const gunichar2 *names, glong length, gboolean gnome_list) {
+	GString *list = g_string_new(gnome_list ? "copy" : NULL);
+	const gchar *separator = gnome_list ? "\n" : "\r\n";
+	gboolean empty = TRUE;
+	glong start = 0, i;
+	for (i = 0; i <= length; i++) {
+		gchar *utf8, *filename = NULL, *uri = NULL;
+		if (i < length && names[i] != 0) continue;
+		if (i > start) {
+			utf8 = g_utf16_to_utf8(names + start, i - start, NULL, NULL, NULL);
+			if (utf8) filename = g_filename_from_utf8(utf8, -1, NULL, NULL, NULL);
+			if (filename) uri = g_filename_to_uri(filename, NULL, NULL);
+			if (uri) {
+				if (gnome_list || !empty) g_string_append(list, separator);
+				g_string_append(list, uri);
+				empty = FALSE;
+			}
+			g_free(uri);
+			g_free(filename);
+			g_free(utf8);
+		}
+		start = i + 1;
+	}
+	return g_string_free(list, empty);
+}
+
+/*
+ * Converts the URIs of a text/uri-list, or of an x-special/gnome-copied-files
+ * list when gnome_list is set, to file names separated by nul characters.
+ * URIs that are not local files are skipped. Returns NULL if no file name
+ * could be converted, otherwise stores the number of UTF-16 characters in
+ * items_written.
+ */
+gunichar2* swt_uri_list_decode(const gchar *list, glong length, gboolean gnome_list, glong *items_written) {
+	GArray *names = g_array_new(FALSE, FALSE, sizeof(gunichar2));
+	const gunichar2 separator = 0;
+	gboolean first = TRUE;
+	glong start = 0, end, i;
+	for (i = 0; i <= length; i++) {
+		gchar *uri, *filename, *utf8;
+		gunichar2 *utf16;
+		glong written = 0;
+		if (i < length && list[i] != '\n') continue;
+		end = i;
+		if (end > start && list[end - 1] == '\r') end--;
+		/* The first line of a gnome list is always either 'copy' or 'cut' */
+		if (end > start && !(gnome_list && first)) {
+			uri = g_strndup(list + start, end - start);
+			filename = g_filename_from_uri(uri, NULL, NULL);
+			g_free(uri);
+			if (filename) {
+				utf8 = g_filename_to_utf8(filename, -1, NULL, NULL, NULL);
+				if (!utf8) utf8 = g_filename_display_name(filename);
+				g_free(filename);
+				utf16 = utf8 ? g_utf8_to_utf16(utf8, -1, NULL, &written, NULL) : NULL;
+				g_free(utf8);
+				if (utf16) {
+					if (names->len > 0) g_array_append_val(names, separator);
+					g_array_append_vals(names, utf16, written);
+					g_free(utf16);
+				}
+			}
+		}
+		first = FALSE;
+		start = i + 1;
+	}
+	if (items_written) *items_written = names->len;
+	return (gunichar2 *)g_array_free(names, names->len == 0);
+}
+
+/*
+ * Marshals the name, executable, icon and URI support of every GAppInfo in
+ * list to one buffer of nul terminated UTF-8 strings, four per application.
+ * Applications without an executable are skipped. Returns a buffer to be
+ * freed with g_free, and stores its length in bytes in length.
+ */
+gchar* swt_app_info_marshal(GList *list, glong *length) {
+	GString *buffer = g_string_new(NULL);
+	GList *item;
+	for (item = list; item != NULL; item = item->next) {
+		GAppInfo *info = item->data;
+		const gchar *name, *executable;
+		gchar *icon_name = NULL;
+		GIcon *icon;
+		if (info == NULL) continue;
+		executable = g_app_info_get_executable(info);
+		if (executable == NULL || *executable == '\0') continue;
+		name = g_app_info_get_name(info);
+		icon = g_app_info_get_icon(info);
+		if (icon) icon_name = g_icon_to_string(icon);
+		g_string_append(buffer, name ? name : "");
+		g_string_append_c(buffer, '\0');
+		g_string_append(buffer, executable);
+		g_string_append_c(buffer, '\0');
+		g_string_append(buffer, icon_name ? icon_name : "");
+		g_string_append_c(buffer, '\0');
+		g_string_append_c(buffer, g_app_info_supports_uris(info) ? '1' : '0');
+		g_string_append_c(buffer, '\0');
+		g_free(icon_name);
+	}
+	if (length) *length = buffer->len;
+	return g_string_free(buffer, FALSE);
+}
+
+/*
+ * Sets the text of several columns of a GtkListStore row with a single call
+ * to gtk_list_store_set_valuesv, so that row-changed is emitted only once.
+ * The UTF-16 texts follow each other in texts, the length of each one is
+ * given in lengths.
+ */
+void swt_list_store_set_texts(GtkListStore *store, GtkTreeIter *iter, const gint *columns, const gunichar2 *texts, const gint *lengths, gint n_values) {
+	GValue *values = g_new0(GValue, n_values);
+	glong offset = 0;
+	gint i;
+	for (i = 0; i < n_values; i++) {
+		g_value_init(&values[i], G_TYPE_STRING);
+		g_value_take_string(&values[i], g_utf16_to_utf8(texts + offset, lengths[i], NULL, NULL, NULL));
+		offset += lengths[i];
+	}
+	gtk_list_store_set_valuesv(store, iter, (gint *)columns, values, n_values);
+	for (i = 0; i < n_values; i++) {
+		g_value_unset(&values[i]);
+	}
+	g_free(values);
+}
+
+/*
+ * Walks the children of parent, or the top level rows when parent is NULL,
+ * once and stores the int value of the given column of each of them in ids.
+ * Returns the number of children stored, at most length.
+ */
+gint swt_tree_model_get_child_ids(GtkTreeModel *model, GtkTreeIter *parent, gint column, gint *ids, gint length) {
+	GtkTreeIter iter;
+	gint count = 0;
+	if (length <= 0 || !gtk_tree_model_iter_children(model, &iter, parent)) return 0;
+	do {
+		gint id = -1;
+		gtk_tree_model_get(model, &iter, column, &id, -1);
+		ids[count++] = id;
+	} while (count < length && gtk_tree_model_iter_next(model, &iter));
+	return count;
+}
+
 #if !defined(GTK4)
 
 struct _SwtFixedPrivate {
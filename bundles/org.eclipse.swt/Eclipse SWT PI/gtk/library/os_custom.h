@@ -90,6 +90,11 @@ gchar* g_utf16_offset_to_pointer(const gchar*, glong);
 glong g_utf16_strlen(const gchar*, glong max);
 glong g_utf16_offset_to_utf8_offset(const gchar*, glong);
 glong g_utf8_offset_to_utf16_offset(const gchar*, glong);
+gchar* swt_uri_list_encode(const gunichar2*, glong, gboolean);
+gunichar2* swt_uri_list_decode(const gchar*, glong, gboolean, glong*);
+gchar* swt_app_info_marshal(GList*, glong*);
+void swt_list_store_set_texts(GtkListStore*, GtkTreeIter*, const gint*, const gunichar2*, const gint*, gint);
+gint swt_tree_model_get_child_ids(GtkTreeModel*, GtkTreeIter*, gint, gint*, gint);
 
 #define SWT_TYPE_FIXED (swt_fixed_get_type ())
 #define SWT_FIXED(obj) (G_TYPE_CHECK_INSTANCE_CAST ((obj), SWT_TYPE_FIXED, SwtFixed))
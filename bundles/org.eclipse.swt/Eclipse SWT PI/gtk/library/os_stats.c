@@ -1261,6 +1261,7 @@ char * OS_nativeFunctionNames[] = {
 	"printerOptionWidgetNewProc_1CALLBACK",
 	"realpath",
 	"strcmp",
+	"swt_1app_1info_1marshal",
 	"swt_1debug_1on_1fatal_1warnings",
 	"swt_1fixed_1accessible_1get_1type",
 	"swt_1fixed_1accessible_1register_1accessible",
@@ -1270,7 +1271,11 @@ char * OS_nativeFunctionNames[] = {
 	"swt_1fixed_1remove",
 	"swt_1fixed_1resize",
 	"swt_1fixed_1restack",
+	"swt_1list_1store_1set_1texts",
 	"swt_1set_1lock_1functions",
+	"swt_1tree_1model_1get_1child_1ids",
+	"swt_1uri_1list_1decode",
+	"swt_1uri_1list_1encode",
 	"ubuntu_1menu_1proxy_1get",
 };
 #define NATIVE_FUNCTION_COUNT sizeof(OS_nativeFunctionNames) / sizeof(char*)
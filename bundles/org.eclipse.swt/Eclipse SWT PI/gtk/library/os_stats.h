@@ -1235,6 +1235,7 @@ typedef enum {
 	printerOptionWidgetNewProc_1CALLBACK_FUNC,
 	realpath_FUNC,
 	strcmp_FUNC,
+	swt_1app_1info_1marshal_FUNC,
 	swt_1debug_1on_1fatal_1warnings_FUNC,
 	swt_1fixed_1accessible_1get_1type_FUNC,
 	swt_1fixed_1accessible_1register_1accessible_FUNC,
@@ -1244,6 +1245,10 @@ typedef enum {
 	swt_1fixed_1remove_FUNC,
 	swt_1fixed_1resize_FUNC,
 	swt_1fixed_1restack_FUNC,
+	swt_1list_1store_1set_1texts_FUNC,
 	swt_1set_1lock_1functions_FUNC,
+	swt_1tree_1model_1get_1child_1ids_FUNC,
+	swt_1uri_1list_1decode_FUNC,
+	swt_1uri_1list_1encode_FUNC,
 	ubuntu_1menu_1proxy_1get_FUNC,
 } OS_FUNCS;
@@ -346,7 +346,12 @@ public class OS extends C {
 	public static final byte[] realize = ascii("realize");
 	public static final byte[] row_activated = ascii("row-activated");
 	public static final byte[] row_changed = ascii("row-changed");
+	public static final byte[] row_collapsed = ascii("row-collapsed");
+	public static final byte[] row_deleted = ascii("row-deleted");
+	public static final byte[] row_expanded = ascii("row-expanded");
 	public static final byte[] row_has_child_toggled = ascii("row-has-child-toggled");
+	public static final byte[] row_inserted = ascii("row-inserted");
+	public static final byte[] rows_reordered = ascii("rows-reordered");
 	public static final byte[] scale_changed = ascii("scale-changed");
 	public static final byte[] scroll_child = ascii("scroll-child");
 	public static final byte[] scroll_event = ascii("scroll-event");
@@ -555,6 +560,51 @@ public class OS extends C {
 	 */
 	/* custom version of g_utf8 for 16 bit */
 	public static final native long g_utf16_offset_to_utf8_offset(long str, long offset);
+	/**
+	 * @param names cast=(const gunichar2 *),flags=no_out
+	 * @param length cast=(glong)
+	 * @param gnome_list cast=(gboolean)
+	 * @category custom
+	 */
+	/* Converts nul separated file names to a URI list in one call */
+	public static final native long swt_uri_list_encode(char[] names, long length, boolean gnome_list);
+	/**
+	 * @param list cast=(const gchar *)
+	 * @param length cast=(glong)
+	 * @param gnome_list cast=(gboolean)
+	 * @param items_written cast=(glong *)
+	 * @category custom
+	 */
+	/* Converts a URI list to nul separated file names in one call */
+	public static final native long swt_uri_list_decode(long list, long length, boolean gnome_list, long[] items_written);
+	/**
+	 * @param list cast=(GList *)
+	 * @param length cast=(glong *)
+	 * @category custom
+	 */
+	/* Marshals the name, executable, icon and URI support of a list of GAppInfo in one call */
+	public static final native long swt_app_info_marshal(long list, long[] length);
+	/**
+	 * @param store cast=(GtkListStore *)
+	 * @param iter cast=(GtkTreeIter *)
+	 * @param columns cast=(const gint *),flags=no_out
+	 * @param texts cast=(const gunichar2 *),flags=no_out
+	 * @param lengths cast=(const gint *),flags=no_out
+	 * @param n_values cast=(gint)
+	 * @category custom
+	 */
+	/* Sets the texts of several columns of a list store row in one call */
+	public static final native void swt_list_store_set_texts(long store, long iter, int[] columns, char[] texts, int[] lengths, int n_values);
+	/**
+	 * @param model cast=(GtkTreeModel *)
+	 * @param parent cast=(GtkTreeIter *)
+	 * @param column cast=(gint)
+	 * @param ids cast=(gint *),flags=no_in
+	 * @param length cast=(gint)
+	 * @category custom
+	 */
+	/* Reads an int column of all children of a tree model row in one walk */
+	public static final native int swt_tree_model_get_child_ids(long model, long parent, int column, int[] ids, int length);
 
 	/** CUSTOM_CODE END */
 
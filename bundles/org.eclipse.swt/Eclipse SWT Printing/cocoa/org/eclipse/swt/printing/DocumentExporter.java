@@ -0,0 +1,190 @@
+/*******************************************************************************
+ * Copyright (c) 2026 IBM Corporation and others.
+ *
+ * This program and the accompanying materials
+ * are made available under the terms of the Eclipse Public License 2.0
+ * which accompanies this distribution, and is available at
+ * https://www.eclipse.org/legal/epl-2.0/
+ *
+ * SPDX-License-Identifier: EPL-2.0
+ *
+ * Contributors:
+ *     IBM Corporation - initial API and implementation
+ *******************************************************************************/
+package org.eclipse.swt.printing;
+
+
+import java.io.*;
+
+import org.eclipse.swt.*;
+import org.eclipse.swt.graphics.*;
+
+/**
+ * Instances of this class are used to export a document as PDF,
+ * PostScript or SVG to an output stream, without a print dialog
+ * or a printer.
+ * Applications create a GC on an exporter using <code>new GC(exporter)</code>
+ * and then draw each page on the GC using the usual graphics calls,
+ * bracketed by <code>startPage</code> and <code>endPage</code>.
+ * <p>
+ * Exporting documents is only implemented on GTK. On this platform
+ * the constructor throws an <code>SWTError</code> with the code
+ * <code>ERROR_NOT_IMPLEMENTED</code>.
+ * </p>
+ *
+ * @see Printer
+ * @since 3.122
+ */
+public final class DocumentExporter extends Device {
+	/**
+	 * Document format for Portable Document Format (value is 1).
+	 */
+	public static final int PDF = 1;
+
+	/**
+	 * Document format for PostScript (value is 2).
+	 */
+	public static final int POSTSCRIPT = 2;
+
+	/**
+	 * Document format for Scalable Vector Graphics (value is 3).
+	 */
+	public static final int SVG = 3;
+
+/**
+ * Constructs a new exporter that writes a document in the given
+ * format and page size to the given stream.
+ *
+ * @param stream the stream to write the document to
+ * @param format the document format, one of <code>PDF</code>, <code>POSTSCRIPT</code> or <code>SVG</code>
+ * @param width the width of the pages, in points (1/72 inch)
+ * @param height the height of the pages, in points (1/72 inch)
+ *
+ * @exception IllegalArgumentException <ul>
+ *    <li>ERROR_NULL_ARGUMENT - if the stream is null</li>
+ *    <li>ERROR_INVALID_ARGUMENT - if the format is not supported or the page size is not positive</li>
+ * </ul>
+ * @exception SWTError <ul>
+ *    <li>ERROR_NOT_IMPLEMENTED - always, exporting documents is not implemented on this platform</li>
+ * </ul>
+ *
+ * @see #PDF
+ * @see #POSTSCRIPT
+ * @see #SVG
+ */
+public DocumentExporter(OutputStream stream, int format, double width, double height) {
+	super(checkData(stream, format, width, height));
+}
+
+static DeviceData checkData(OutputStream stream, int format, double width, double height) {
+	if (stream == null) SWT.error(SWT.ERROR_NULL_ARGUMENT);
+	if (format != PDF && format != POSTSCRIPT && format != SVG) SWT.error(SWT.ERROR_INVALID_ARGUMENT);
+	if (!(width > 0) || !(height > 0)) SWT.error(SWT.ERROR_INVALID_ARGUMENT);
+	SWT.error(SWT.ERROR_NOT_IMPLEMENTED);
+	return null;
+}
+
+/**
+ * Invokes platform specific functionality to allocate a new GC handle.
+ * <p>
+ * <b>IMPORTANT:</b> This method is <em>not</em> part of the public
+ * API for <code>DocumentExporter</code>. It is marked public only so that it
+ * can be shared within the packages provided by SWT. It is not
+ * available on all platforms, and should never be called from
+ * application code.
+ * </p>
+ *
+ * @param data the platform specific GC data
+ * @return the platform specific GC handle
+ *
+ * @noreference This method is not intended to be referenced by clients.
+ */
+@Override
+public long internal_new_GC(GCData data) {
+	SWT.error(SWT.ERROR_NO_HANDLES);
+	return 0;
+}
+
+/**
+ * Invokes platform specific functionality to dispose a GC handle.
+ * <p>
+ * <b>IMPORTANT:</b> This method is <em>not</em> part of the public
+ * API for <code>DocumentExporter</code>. It is marked public only so that it
+ * can be shared within the packages provided by SWT. It is not
+ * available on all platforms, and should never be called from
+ * application code.
+ * </p>
+ *
+ * @param hDC the platform specific GC handle
+ * @param data the platform specific GC data
+ *
+ * @noreference This method is not intended to be referenced by clients.
+ */
+@Override
+public void internal_dispose_GC(long hDC, GCData data) {
+}
+
+/**
+ * Starts a page and returns true if the page started successfully
+ * and false otherwise.
+ *
+ * @return true if the page started successfully and false otherwise.
+ *
+ * @exception SWTException <ul>
+ *    <li>ERROR_DEVICE_DISPOSED - if the receiver has been disposed</li>
+ * </ul>
+ *
+ * @see #endPage
+ * @see #finish
+ */
+public boolean startPage() {
+	checkDevice();
+	return false;
+}
+
+/**
+ * Ends the current page, which writes it to the stream.
+ *
+ * @exception SWTException <ul>
+ *    <li>ERROR_DEVICE_DISPOSED - if the receiver has been disposed</li>
+ *    <li>ERROR_IO - if an I/O error occurs while writing to the stream</li>
+ * </ul>
+ *
+ * @see #startPage
+ * @see #finish
+ */
+public void endPage() {
+	checkDevice();
+}
+
+/**
+ * Writes the end of the document to the stream. No pages can be
+ * added afterwards. The stream is not closed.
+ *
+ * @exception SWTException <ul>
+ *    <li>ERROR_DEVICE_DISPOSED - if the receiver has been disposed</li>
+ *    <li>ERROR_IO - if an I/O error occurs while writing to the stream</li>
+ * </ul>
+ *
+ * @see #startPage
+ * @see #endPage
+ */
+public void finish() {
+	checkDevice();
+}
+
+/**
+ * Returns the number of pages that have ended.
+ *
+ * @return the number of pages
+ *
+ * @exception SWTException <ul>
+ *    <li>ERROR_DEVICE_DISPOSED - if the receiver has been disposed</li>
+ * </ul>
+ */
+public int getPageCount() {
+	checkDevice();
+	return 0;
+}
+
+}
@@ -0,0 +1,418 @@
+/*******************************************************************************
+ * Copyright (c) 2026 IBM Corporation and others.
+ *
+ * This program and the accompanying materials
+ * are made available under the terms of the Eclipse Public License 2.0
+ * which accompanies this distribution, and is available at
+ * https://www.eclipse.org/legal/epl-2.0/
+ *
+ * SPDX-License-Identifier: EPL-2.0
+ *
+ * Contributors:
+ *     IBM Corporation - initial API and implementation
+ *******************************************************************************/
+package org.eclipse.swt.printing;
+
+
+import java.io.*;
+import java.lang.reflect.*;
+
+import org.eclipse.swt.*;
+import org.eclipse.swt.graphics.*;
+import org.eclipse.swt.internal.*;
+import org.eclipse.swt.internal.cairo.*;
+
+/**
+ * Instances of this class are used to export a document as PDF,
+ * PostScript or SVG to an output stream, without a print dialog
+ * or a printer.
+ * Applications create a GC on an exporter using <code>new GC(exporter)</code>
+ * and then draw each page on the GC using the usual graphics calls,
+ * bracketed by <code>startPage</code> and <code>endPage</code>.
+ * <p>
+ * Each page is written to the stream when it ends, so the memory
+ * needed to export a document does not grow with its number of pages.
+ * An SVG document has a single page.
+ * </p><p>
+ * Application code must explicitly invoke the <code>DocumentExporter.dispose()</code>
+ * method to release the operating system resources managed by each instance
+ * when those instances are no longer required. The output stream is not
+ * closed by the exporter.
+ * </p><p>
+ * Exporting documents is only implemented on GTK. On other platforms
+ * the constructor throws an <code>SWTError</code> with the code
+ * <code>ERROR_NOT_IMPLEMENTED</code>.
+ * </p>
+ *
+ * @see Printer
+ * @since 3.122
+ */
+public final class DocumentExporter extends Device {
+	/**
+	 * Document format for Portable Document Format (value is 1).
+	 */
+	public static final int PDF = 1;
+
+	/**
+	 * Document format for PostScript (value is 2).
+	 */
+	public static final int POSTSCRIPT = 2;
+
+	/**
+	 * Document format for Scalable Vector Graphics (value is 3).
+	 */
+	public static final int SVG = 3;
+
+	static final class ExportData extends DeviceData {
+		OutputStream stream;
+		int format;
+		double width, height;
+	}
+
+	ExportData data;
+	long surface;
+	long cairo;
+	Callback writeCallback;
+	byte [] writeBuffer;
+	IOException writeError;
+	int pageCount;
+	boolean pageStarted, finished;
+
+	/**
+	 * whether or not a GC was created for this exporter
+	 */
+	boolean isGCCreated = false;
+
+/**
+ * Constructs a new exporter that writes a document in the given
+ * format and page size to the given stream.
+ * <p>
+ * Note: You must dispose the exporter when it is no longer required.
+ * </p>
+ *
+ * @param stream the stream to write the document to
+ * @param format the document format, one of <code>PDF</code>, <code>POSTSCRIPT</code> or <code>SVG</code>
+ * @param width the width of the pages, in points (1/72 inch)
+ * @param height the height of the pages, in points (1/72 inch)
+ *
+ * @exception IllegalArgumentException <ul>
+ *    <li>ERROR_NULL_ARGUMENT - if the stream is null</li>
+ *    <li>ERROR_INVALID_ARGUMENT - if the format is not supported or the page size is not positive</li>
+ * </ul>
+ * @exception SWTError <ul>
+ *    <li>ERROR_NO_HANDLES - if the document could not be created</li>
+ * </ul>
+ *
+ * @see #PDF
+ * @see #POSTSCRIPT
+ * @see #SVG
+ * @see Device#dispose
+ */
+public DocumentExporter(OutputStream stream, int format, double width, double height) {
+	super(checkData(stream, format, width, height));
+}
+
+static DeviceData checkData(OutputStream stream, int format, double width, double height) {
+	if (stream == null) SWT.error(SWT.ERROR_NULL_ARGUMENT);
+	if (format != PDF && format != POSTSCRIPT && format != SVG) SWT.error(SWT.ERROR_INVALID_ARGUMENT);
+	if (!(width > 0) || !(height > 0)) SWT.error(SWT.ERROR_INVALID_ARGUMENT);
+	ExportData data = new ExportData();
+	data.stream = stream;
+	data.format = format;
+	data.width = width;
+	data.height = height;
+	return data;
+}
+
+/**
+ * Creates the document surface.
+ * This method is called internally by the instance creation
+ * mechanism of the <code>Device</code> class.
+ * @param deviceData the device data
+ */
+@Override
+protected void create(DeviceData deviceData) {
+	this.data = (ExportData)deviceData;
+	Printer.gtk_init();
+	writeCallback = new Callback(this, "writeProc", int.class, new Type[] {long.class, long.class, int.class}); //$NON-NLS-1$
+	long writeProc = writeCallback.getAddress();
+	switch (data.format) {
+		case PDF:
+			surface = Cairo.cairo_pdf_surface_create_for_stream(writeProc, 0, data.width, data.height);
+			break;
+		case POSTSCRIPT:
+			surface = Cairo.cairo_ps_surface_create_for_stream(writeProc, 0, data.width, data.height);
+			break;
+		case SVG:
+			surface = Cairo.cairo_svg_surface_create_for_stream(writeProc, 0, data.width, data.height);
+			break;
+	}
+	if (surface == 0 || Cairo.cairo_surface_status(surface) != Cairo.CAIRO_STATUS_SUCCESS) {
+		if (surface != 0) Cairo.cairo_surface_destroy(surface);
+		surface = 0;
+		writeCallback.dispose();
+		writeCallback = null;
+		SWT.error(SWT.ERROR_NO_HANDLES);
+	}
+	cairo = Cairo.cairo_create(surface);
+	if (cairo == 0) {
+		Cairo.cairo_surface_destroy(surface);
+		cairo = surface = 0;
+		writeCallback.dispose();
+		writeCallback = null;
+		SWT.error(SWT.ERROR_NO_HANDLES);
+	}
+}
+
+/**
+ * Destroys the document surface, writing the end of the document
+ * if it has not been finished.
+ * This method is called internally by the dispose
+ * mechanism of the <code>Device</code> class.
+ */
+@Override
+protected void destroy() {
+	if (cairo != 0) Cairo.cairo_destroy(cairo);
+	/* Destroying the surface finishes it, which writes to the stream */
+	if (surface != 0) Cairo.cairo_surface_destroy(surface);
+	if (writeCallback != null) writeCallback.dispose();
+	cairo = surface = 0;
+	writeCallback = null;
+	writeBuffer = null;
+}
+
+int writeProc(long closure, long data, int length) {
+	if (writeError != null) return Cairo.CAIRO_STATUS_WRITE_ERROR;
+	if (writeBuffer == null || writeBuffer.length < length) {
+		writeBuffer = new byte [Math.max(length, 4096)];
+	}
+	C.memmove(writeBuffer, data, length);
+	try {
+		this.data.stream.write(writeBuffer, 0, length);
+	} catch (IOException e) {
+		writeError = e;
+		return Cairo.CAIRO_STATUS_WRITE_ERROR;
+	}
+	return Cairo.CAIRO_STATUS_SUCCESS;
+}
+
+void checkWrite() {
+	if (writeError != null) SWT.error(SWT.ERROR_IO, writeError);
+}
+
+/**
+ * Invokes platform specific functionality to allocate a new GC handle.
+ * <p>
+ * <b>IMPORTANT:</b> This method is <em>not</em> part of the public
+ * API for <code>DocumentExporter</code>. It is marked public only so that it
+ * can be shared within the packages provided by SWT. It is not
+ * available on all platforms, and should never be called from
+ * application code.
+ * </p>
+ *
+ * @param data the platform specific GC data
+ * @return the platform specific GC handle
+ *
+ * @noreference This method is not intended to be referenced by clients.
+ */
+@Override
+public long internal_new_GC(GCData data) {
+	long gc = cairo;
+	if (gc == 0 || finished) SWT.error(SWT.ERROR_NO_HANDLES);
+	if (data != null) {
+		if (isGCCreated) SWT.error(SWT.ERROR_INVALID_ARGUMENT);
+		int mask = SWT.LEFT_TO_RIGHT | SWT.RIGHT_TO_LEFT;
+		if ((data.style & mask) == 0) {
+			data.style |= SWT.LEFT_TO_RIGHT;
+		}
+		data.device = this;
+		data.drawable = 0;
+		data.backgroundRGBA = getSystemColor (SWT.COLOR_WHITE).handle;
+		data.foregroundRGBA = getSystemColor (SWT.COLOR_BLACK).handle;
+		data.font = getSystemFont ();
+		data.width = (int)this.data.width;
+		data.height = (int)this.data.height;
+		Cairo.cairo_identity_matrix(cairo);
+		double[] matrix = new double[6];
+		Cairo.cairo_get_matrix(cairo, matrix);
+		data.identity = matrix;
+		data.cairo = cairo;
+		isGCCreated = true;
+	}
+	return gc;
+}
+
+/**
+ * Invokes platform specific functionality to dispose a GC handle.
+ * <p>
+ * <b>IMPORTANT:</b> This method is <em>not</em> part of the public
+ * API for <code>DocumentExporter</code>. It is marked public only so that it
+ * can be shared within the packages provided by SWT. It is not
+ * available on all platforms, and should never be called from
+ * application code.
+ * </p>
+ *
+ * @param hDC the platform specific GC handle
+ * @param data the platform specific GC data
+ *
+ * @noreference This method is not intended to be referenced by clients.
+ */
+@Override
+public void internal_dispose_GC(long hDC, GCData data) {
+	if (data != null) isGCCreated = false;
+}
+
+/**
+ * @noreference This method is not intended to be referenced by clients.
+ */
+@Override
+public boolean isAutoScalable() {
+	return false;
+}
+
+/**
+ * Starts a page and returns true if the page started successfully
+ * and false otherwise.
+ * <p>
+ * This method may be called any number of times along with a matching
+ * endPage, until the document is finished. An SVG document can only
+ * have one page.
+ * </p>
+ *
+ * @return true if the page started successfully and false otherwise.
+ *
+ * @exception SWTException <ul>
+ *    <li>ERROR_DEVICE_DISPOSED - if the receiver has been disposed</li>
+ * </ul>
+ *
+ * @see #endPage
+ * @see #finish
+ */
+public boolean startPage() {
+	checkDevice();
+	if (finished || pageStarted || writeError != null) return false;
+	if (data.format == SVG && pageCount > 0) return false;
+	pageStarted = true;
+	return true;
+}
+
+/**
+ * Ends the current page, which writes it to the stream.
+ *
+ * @exception SWTException <ul>
+ *    <li>ERROR_DEVICE_DISPOSED - if the receiver has been disposed</li>
+ *    <li>ERROR_IO - if an I/O error occurs while writing to the stream</li>
+ * </ul>
+ *
+ * @see #startPage
+ * @see #finish
+ */
+public void endPage() {
+	checkDevice();
+	if (!pageStarted) return;
+	pageStarted = false;
+	pageCount++;
+	Cairo.cairo_show_page(cairo);
+	checkWrite();
+}
+
+/**
+ * Writes the end of the document to the stream. No pages can be
+ * added afterwards. The stream is not closed.
+ *
+ * @exception SWTException <ul>
+ *    <li>ERROR_DEVICE_DISPOSED - if the receiver has been disposed</li>
+ *    <li>ERROR_IO - if an I/O error occurs while writing to the stream</li>
+ * </ul>
+ *
+ * @see #startPage
+ * @see #endPage
+ */
+public void finish() {
+	checkDevice();
+	if (finished) return;
+	if (pageStarted) endPage();
+	finished = true;
+	Cairo.cairo_surface_finish(surface);
+	checkWrite();
+	try {
+		data.stream.flush();
+	} catch (IOException e) {
+		writeError = e;
+		checkWrite();
+	}
+}
+
+/**
+ * Returns the number of pages that have ended.
+ *
+ * @return the number of pages
+ *
+ * @exception SWTException <ul>
+ *    <li>ERROR_DEVICE_DISPOSED - if the receiver has been disposed</li>
+ * </ul>
+ */
+public int getPageCount() {
+	checkDevice();
+	return pageCount;
+}
+
+/**
+ * Returns a point whose x coordinate is the horizontal
+ * dots per inch of the document, and whose y coordinate
+ * is the vertical dots per inch of the document. One
+ * unit of a document is one point.
+ *
+ * @return the horizontal and vertical DPI
+ *
+ * @exception SWTException <ul>
+ *    <li>ERROR_DEVICE_DISPOSED - if the receiver has been disposed</li>
+ * </ul>
+ */
+@Override
+public Point getDPI() {
+	checkDevice();
+	return new Point(72, 72);
+}
+
+/**
+ * Returns a rectangle describing the receiver's size and location.
+ * <p>
+ * For a document, this is the size of a page, in points.
+ * </p>
+ *
+ * @return the bounding rectangle
+ *
+ * @exception SWTException <ul>
+ *    <li>ERROR_DEVICE_DISPOSED - if the receiver has been disposed</li>
+ * </ul>
+ *
+ * @see #getClientArea
+ */
+@Override
+public Rectangle getBounds() {
+	checkDevice();
+	return new Rectangle(0, 0, (int) data.width, (int) data.height);
+}
+
+/**
+ * Returns a rectangle which describes the area of the
+ * receiver which is capable of displaying data.
+ * <p>
+ * For a document, this is the size of a page, in points.
+ * </p>
+ *
+ * @return the client area
+ *
+ * @exception SWTException <ul>
+ *    <li>ERROR_DEVICE_DISPOSED - if the receiver has been disposed</li>
+ * </ul>
+ *
+ * @see #getBounds
+ */
+@Override
+public Rectangle getClientArea() {
+	return getBounds();
+}
+
+}
@@ -1,5 +1,5 @@
 /*******************************************************************************
- * Copyright (c) 2000, 2017 IBM Corporation and others.
+ * Copyright (c) 2000, 2026 IBM Corporation and others.
  *
  * This program and the accompanying materials
  * are made available under the terms of the Eclipse Public License 2.0
@@ -14,10 +14,12 @@
 package org.eclipse.swt.program;
 
 import java.io.*;
+import java.nio.charset.*;
 import java.nio.file.*;
 import java.nio.file.Path;
 import java.util.*;
 import java.util.List;
+import java.util.regex.Pattern;
 
 import org.eclipse.swt.*;
 import org.eclipse.swt.graphics.*;
@@ -45,8 +47,16 @@ public final class Program {
 	 */
 	boolean gioExpectUri;
 
-	static long modTime;
-	static Map<String, List<String>> mimeTable;
+	static final Path MIME_DIRECTORY = Paths.get("/usr/share/mime"); //$NON-NLS-1$
+	static final String REFRESH_INTERVAL_KEY = "org.eclipse.swt.internal.gtk.programRefreshInterval"; //$NON-NLS-1$
+	static final int REFRESH_INTERVAL = Integer.getInteger(REFRESH_INTERVAL_KEY, 2000);
+
+	static MimeIndex mimeIndex;
+	static long mimeCheckTime, mimeStatCount, mimeLoadCount;
+	static Program[] allPrograms;
+	static long allProgramsTime;
+	static Map<String, Program> defaultPrograms;
+	static long defaultProgramsTime;
 
 	static final String PREFIX_HTTP = "http://"; //$NON-NLS-1$
 	static final String PREFIX_HTTPS = "https://"; //$NON-NLS-1$
@@ -199,113 +209,294 @@ public ImageData getImageData() {
 	return data;
 }
 
-	static Map<String, List<String>> gio_getMimeInfo() {
-		/*
-		 * The file 'globs' contain the file extensions associated to the
-		 * mime-types. Each line that has to be parsed corresponds to a
-		 * different extension of a mime-type. The template of such line is -
-		 * application/pdf:*.pdf
-		 */
-		Path path = Paths.get("/usr/share/mime/globs");
-		long lastModified = 0;
+/**
+ * An index of the globs of a shared MIME-info database directory. Simple
+ * extensions such as <code>*.pdf</code> or <code>*.tar.gz</code> are looked
+ * up in a hash table, other glob patterns are matched in order of weight and
+ * the results are remembered. The index is read from the <code>globs2</code>
+ * file, which carries weights, or from the <code>globs</code> file of older
+ * databases.
+ */
+static final class MimeIndex {
+	static final int DEFAULT_WEIGHT = 50;
+
+	final Path path;
+	final long modTime, size;
+	/* extension, including the leading '.', to its MIME types by decreasing weight */
+	final Map<String, String[]> extensions;
+	final String[] patterns, patternTypes;
+	final Pattern[] compiledPatterns;
+	final Map<String, String> patternMatches = new HashMap<>();
+
+	MimeIndex(Path path, long modTime, long size, Map<String, String[]> extensions, String[] patterns, String[] patternTypes) {
+		this.path = path;
+		this.modTime = modTime;
+		this.size = size;
+		this.extensions = extensions;
+		this.patterns = patterns;
+		this.patternTypes = patternTypes;
+		this.compiledPatterns = new Pattern[patterns.length];
+	}
+
+	/**
+	 * Returns the index of the database in directory, or previous when its
+	 * globs file has not changed since previous was read.
+	 */
+	static MimeIndex load(Path directory, MimeIndex previous) {
+		Path path = directory.resolve("globs2"); //$NON-NLS-1$
+		boolean weighted = Files.isRegularFile(path);
+		if (!weighted) path = directory.resolve("globs"); //$NON-NLS-1$
+		long lastModified = 0, size = 0;
 		try {
 			lastModified = Files.getLastModifiedTime(path).toMillis();
+			size = Files.size(path);
 		} catch (IOException e) {
-			// ignore and reparse the file
+			return null;
 		}
-		if (modTime != 0 && modTime == lastModified) {
-			return mimeTable;
-		} else {
-			try {
-				mimeTable = new HashMap<>();
-				modTime = lastModified;
-				for (String line : Files.readAllLines(path)) {
-					int separatorIndex = line.indexOf(':');
-					if (separatorIndex > 0) {
-						List<String> mimeTypes = new ArrayList<>();
-						String mimeType = line.substring(0, separatorIndex);
-						String extensionFormat = line.substring(separatorIndex + 1);
-						int extensionIndex = extensionFormat.indexOf('.');
-						if (extensionIndex > 0) {
-							String extension = extensionFormat.substring(extensionIndex);
-							if (mimeTable.containsKey(extension)) {
-								/*
-								 * If mimeType already exists, it is required to
-								 * update the existing key (mime-type) with the
-								 * new extension.
-								 */
-								List<String> value = mimeTable.get(extension);
-								mimeTypes.addAll(value);
-							}
-							mimeTypes.add(mimeType);
-							mimeTable.put(extension, mimeTypes);
-						}
+		if (previous != null && previous.path.equals(path) && previous.modTime == lastModified && previous.size == size) {
+			return previous;
+		}
+		try (BufferedReader reader = Files.newBufferedReader(path)) {
+			return parse(path, lastModified, size, reader, weighted);
+		} catch (IOException e) {
+			return null;
+		}
+	}
+
+	/*
+	 * Each line of 'globs2' is weight:mime-type:glob[:flags], for example
+	 * 50:application/pdf:*.pdf, and each line of 'globs' is mime-type:glob.
+	 * Globs are case insensitive unless the flags contain 'cs'.
+	 */
+	static MimeIndex parse(Path path, long modTime, long size, BufferedReader reader, boolean weighted) throws IOException {
+		List<String[]> entries = new ArrayList<>();
+		List<Integer> weights = new ArrayList<>();
+		String line;
+		while ((line = reader.readLine()) != null) {
+			if (line.isEmpty() || line.charAt(0) == '#') continue;
+			int weight = DEFAULT_WEIGHT, start = 0;
+			if (weighted) {
+				int index = line.indexOf(':');
+				if (index <= 0) continue;
+				try {
+					weight = Integer.parseInt(line.substring(0, index));
+				} catch (NumberFormatException e) {
+					continue;
+				}
+				start = index + 1;
+			}
+			int index = line.indexOf(':', start);
+			if (index <= start || index + 1 == line.length()) continue;
+			String mimeType = line.substring(start, index);
+			String glob = line.substring(index + 1), flags = ""; //$NON-NLS-1$
+			if (weighted) {
+				int flagsIndex = glob.indexOf(':');
+				if (flagsIndex != -1) {
+					flags = glob.substring(flagsIndex + 1);
+					glob = glob.substring(0, flagsIndex);
+				}
+			}
+			if (glob.isEmpty() || glob.equals("__NOGLOBS__")) continue; //$NON-NLS-1$
+			entries.add(new String[] {mimeType, glob, flags});
+			weights.add(weight);
+		}
+
+		/* Stable sort by decreasing weight, so that entries of equal weight keep the order of the file */
+		Integer[] order = new Integer[entries.size()];
+		for (int i = 0; i < order.length; i++) order[i] = i;
+		Arrays.sort(order, (a, b) -> weights.get(b) - weights.get(a));
+
+		Map<String, List<String>> types = new LinkedHashMap<>();
+		List<String> patterns = new ArrayList<>(), patternTypes = new ArrayList<>();
+		for (Integer i : order) {
+			String[] entry = entries.get(i);
+			String mimeType = entry[0], glob = entry[1];
+			if (isExtensionGlob(glob)) {
+				List<String> list = types.computeIfAbsent(glob.substring(1), key -> new ArrayList<>(1));
+				if (!list.contains(mimeType)) list.add(mimeType);
+			} else {
+				patterns.add(entry[2].contains("cs") ? glob : glob.toLowerCase(Locale.ROOT)); //$NON-NLS-1$
+				patternTypes.add(mimeType);
+			}
+		}
+		Map<String, String[]> extensions = new LinkedHashMap<>(types.size() * 4 / 3 + 1);
+		for (Map.Entry<String, List<String>> entry : types.entrySet()) {
+			List<String> list = entry.getValue();
+			extensions.put(entry.getKey(), list.toArray(new String[list.size()]));
+		}
+		return new MimeIndex(path, modTime, size, extensions, patterns.toArray(new String[patterns.size()]),
+				patternTypes.toArray(new String[patternTypes.size()]));
+	}
+
+	/* Returns whether glob is '*.' followed by text without any wildcard */
+	static boolean isExtensionGlob(String glob) {
+		if (glob.length() < 3 || glob.charAt(0) != '*' || glob.charAt(1) != '.') return false;
+		for (int i = 2; i < glob.length(); i++) {
+			char c = glob.charAt(i);
+			if (c == '*' || c == '?' || c == '[' || c == '\\') return false;
+		}
+		return true;
+	}
+
+	/* Converts a glob to a regular expression */
+	static Pattern compile(String glob) {
+		StringBuilder regex = new StringBuilder(glob.length() + 8);
+		for (int i = 0; i < glob.length(); i++) {
+			char c = glob.charAt(i);
+			switch (c) {
+				case '*': regex.append(".*"); break; //$NON-NLS-1$
+				case '?': regex.append('.'); break;
+				case '[': {
+					int end = glob.indexOf(']', i + 2);
+					if (end == -1) {
+						regex.append("\\["); //$NON-NLS-1$
+						break;
 					}
+					regex.append('[');
+					int start = i + 1;
+					if (glob.charAt(start) == '!') {
+						regex.append('^');
+						start++;
+					}
+					for (int j = start; j < end; j++) {
+						char member = glob.charAt(j);
+						if (member == '\\' || member == '[' || member == '^' || member == '&') regex.append('\\');
+						regex.append(member);
+					}
+					regex.append(']');
+					i = end;
+					break;
 				}
-				return mimeTable;
-			} catch (IOException e) {
+				default:
+					if ("\\.^$|+(){}".indexOf(c) != -1) regex.append('\\'); //$NON-NLS-1$
+					regex.append(c);
 			}
 		}
-		return null;
+		return Pattern.compile(regex.toString(), Pattern.DOTALL);
 	}
 
-static String gio_getMimeType(String extension) {
-	String mimeType = null;
-	Map<String, List<String>> h = gio_getMimeInfo();
-	if (h != null && h.containsKey(extension)) {
-		List<String> mimeTypes = h.get(extension);
-		mimeType = mimeTypes.get(0);
+	/**
+	 * Returns the MIME types of an extension, which includes the leading
+	 * '.', by decreasing weight, or null.
+	 */
+	String[] getMimeTypes(String extension) {
+		String[] types = extensions.get(extension);
+		if (types == null) {
+			String lowercase = extension.toLowerCase(Locale.ROOT);
+			if (!lowercase.equals(extension)) types = extensions.get(lowercase);
+		}
+		return types;
+	}
+
+	/**
+	 * Returns the MIME type of a file with the given extension, which
+	 * includes the leading '.', or null.
+	 */
+	String getMimeType(String extension) {
+		String[] types = getMimeTypes(extension);
+		if (types != null) return types[0];
+		if (patterns.length == 0) return null;
+		String mimeType = patternMatches.get(extension);
+		if (mimeType == null) {
+			mimeType = ""; //$NON-NLS-1$
+			String name = "file" + extension, lowercase = name.toLowerCase(Locale.ROOT); //$NON-NLS-1$
+			for (int i = 0; i < patterns.length; i++) {
+				if (compiledPatterns[i] == null) compiledPatterns[i] = compile(patterns[i]);
+				Pattern pattern = compiledPatterns[i];
+				if (pattern.matcher(name).matches() || pattern.matcher(lowercase).matches()) {
+					mimeType = patternTypes[i];
+					break;
+				}
+			}
+			patternMatches.put(extension, mimeType);
+		}
+		return mimeType.isEmpty() ? null : mimeType;
+	}
+
+	String[] getExtensions() {
+		return extensions.keySet().toArray(new String[extensions.size()]);
+	}
+}
+
+	/*
+	 * The MIME index and the applications are kept for REFRESH_INTERVAL
+	 * milliseconds before the globs file is checked for changes and the
+	 * applications are asked for again.
+	 */
+	static MimeIndex gio_getMimeInfo() {
+		long now = System.nanoTime() / 1_000_000;
+		if (mimeIndex != null && now - mimeCheckTime < REFRESH_INTERVAL) return mimeIndex;
+		mimeCheckTime = now;
+		MimeIndex index = MimeIndex.load(MIME_DIRECTORY, mimeIndex);
+		if (index != mimeIndex) {
+			mimeIndex = index;
+			mimeLoadCount++;
+		}
+		mimeStatCount++;
+		return mimeIndex;
 	}
-	return mimeType;
+
+static String gio_getMimeType(String extension) {
+	MimeIndex index = gio_getMimeInfo();
+	return index != null ? index.getMimeType(extension) : null;
 }
 
 static Program gio_getProgram(String mimeType) {
+	long now = System.nanoTime() / 1_000_000;
+	if (defaultPrograms == null || now - defaultProgramsTime >= REFRESH_INTERVAL) {
+		defaultPrograms = new HashMap<>();
+		defaultProgramsTime = now;
+	}
+	if (defaultPrograms.containsKey(mimeType)) return defaultPrograms.get(mimeType);
 	Program program = null;
 	byte[] mimeTypeBuffer = Converter.wcsToMbcs (mimeType, true);
 	long application = OS.g_app_info_get_default_for_type (mimeTypeBuffer, false);
 	if (application != 0) {
 		program = gio_getProgram(application);
+		OS.g_object_unref(application);
 	}
+	defaultPrograms.put(mimeType, program);
 	return program;
 }
 
 static Program gio_getProgram (long application) {
-	Program program = new Program();
-	int length;
-	byte[] buffer;
-	long applicationName = OS.g_app_info_get_name (application);
-	if (applicationName != 0) {
-		length = C.strlen (applicationName);
-		if (length > 0) {
-			buffer = new byte [length];
-			C.memmove (buffer, applicationName, length);
-			program.name = new String (Converter.mbcsToWcs (buffer));
-		}
-	}
-	long applicationCommand = OS.g_app_info_get_executable (application);
-	if (applicationCommand != 0) {
-		length = C.strlen (applicationCommand);
-		if (length > 0) {
-			buffer = new byte [length];
-			C.memmove (buffer, applicationCommand, length);
-			program.command = new String (Converter.mbcsToWcs (buffer));
-		}
-	}
-	program.gioExpectUri = OS.g_app_info_supports_uris(application);
-	long icon = OS.g_app_info_get_icon(application);
-	if (icon != 0) {
-		long icon_name = OS.g_icon_to_string(icon);
-		if (icon_name != 0) {
-			length = C.strlen(icon_name);
-			if (length > 0) {
-				buffer = new byte[length];
-				C.memmove(buffer, icon_name, length);
-				program.iconPath = new String(Converter.mbcsToWcs(buffer));
-			}
-			OS.g_free(icon_name);
+	long list = OS.g_list_append (0, application);
+	Program[] programs = gio_getPrograms (list);
+	OS.g_list_free (list);
+	return programs.length > 0 ? programs [0] : null;
+}
+
+/*
+ * Returns the programs of a list of GAppInfo. The name, executable, icon
+ * and URI support of all applications are marshalled by one native call,
+ * applications without an executable are skipped.
+ */
+static Program[] gio_getPrograms (long list) {
+	if (list == 0) return new Program[0];
+	long[] length = new long[1];
+	long ptr = OS.swt_app_info_marshal (list, length);
+	if (ptr == 0) return new Program[0];
+	byte[] buffer = new byte[(int)length[0]];
+	C.memmove (buffer, ptr, buffer.length);
+	OS.g_free (ptr);
+	LinkedHashSet<Program> programs = new LinkedHashSet<>();
+	String[] fields = new String[4];
+	int field = 0, start = 0;
+	for (int i = 0; i < buffer.length; i++) {
+		if (buffer[i] != 0) continue;
+		fields[field++] = new String (buffer, start, i - start, StandardCharsets.UTF_8);
+		start = i + 1;
+		if (field == fields.length) {
+			Program program = new Program();
+			program.name = fields[0];
+			program.command = fields[1];
+			program.iconPath = fields[2].isEmpty() ? null : fields[2];
+			program.gioExpectUri = fields[3].equals("1"); //$NON-NLS-1$
+			programs.add(program);
+			field = 0;
 		}
 	}
-	return program.command != null ? program : null;
+	return programs.toArray(new Program[programs.size()]);
 }
 
 /**
@@ -316,24 +507,29 @@ static Program gio_getProgram (long application) {
  * @return an array of programs
  */
 public static Program[] getPrograms() {
-	long applicationList = OS.g_app_info_get_all ();
-	long list = applicationList;
-	Program program;
-	LinkedHashSet<Program> programs = new LinkedHashSet<>();
-	while (list != 0) {
-		long application = OS.g_list_data(list);
-		if (application != 0) {
-			//TODO: Should the list be filtered or not?
-//			if (OS.g_app_info_should_show(application)) {
-				program = gio_getProgram(application);
-				if (program != null) programs.add(program);
-//			}
-				OS.g_object_unref(application);
+	long now = System.nanoTime() / 1_000_000;
+	if (allPrograms == null || now - allProgramsTime >= REFRESH_INTERVAL) {
+		long applicationList = OS.g_app_info_get_all ();
+		//TODO: Should the list be filtered with g_app_info_should_show or not?
+		allPrograms = gio_getPrograms(applicationList);
+		allProgramsTime = now;
+		long list = applicationList;
+		while (list != 0) {
+			long application = OS.g_list_data(list);
+			if (application != 0) OS.g_object_unref(application);
+			list = OS.g_list_next(list);
 		}
-		list = OS.g_list_next(list);
+		if (applicationList != 0) OS.g_list_free(applicationList);
 	}
-	if (applicationList != 0) OS.g_list_free(applicationList);
-	return programs.toArray(new Program[programs.size()]);
+	return allPrograms.clone();
+}
+
+/*
+ * Returns the number of times the globs file was checked for changes and
+ * the number of times it was read.
+ */
+static long[] getMimeStatistics() {
+	return new long[] {mimeStatCount, mimeLoadCount};
 }
 
 static boolean isExecutable(String fileName) {
@@ -419,12 +615,9 @@ boolean gio_execute(String fileName) {
  * @return an array of extensions
  */
 public static String[] getExtensions() {
-	Map<String, List<String>> mimeInfo = gio_getMimeInfo();
-	if (mimeInfo == null) return new String[0];
-	/* Create a unique set of the file extensions. */
-	List<String> extensions = new ArrayList<>(mimeInfo.keySet());
-	/* Return the list of extensions. */
-	return extensions.toArray(new String[extensions.size()]);
+	MimeIndex index = gio_getMimeInfo();
+	if (index == null) return new String[0];
+	return index.getExtensions();
 }
 
 /**
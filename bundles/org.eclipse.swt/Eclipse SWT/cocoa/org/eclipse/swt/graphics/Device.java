@@ -13,7 +13,10 @@
  *******************************************************************************/
 package org.eclipse.swt.graphics;
 
+import java.util.Map;
+
 import org.eclipse.swt.*;
+import org.eclipse.swt.internal.AllocationTracker;
 import org.eclipse.swt.internal.ExceptionStash;
 import org.eclipse.swt.internal.cocoa.*;
 
@@ -31,9 +34,7 @@ public abstract class Device implements Drawable {
 	public static boolean DEBUG;
 	boolean debug = DEBUG;
 	boolean tracking = DEBUG;
-	Error [] errors;
-	Object [] objects;
-	Object trackingLock;
+	AllocationTracker tracker;
 
 	/* Disposed flag */
 	volatile boolean disposed;
@@ -166,17 +167,11 @@ public void setTracking(boolean tracking) {
 }
 
 private void startTracking() {
-	errors = new Error [128];
-	objects = new Object [128];
-	trackingLock = new Object ();
+	tracker = new AllocationTracker ();
 }
 
 private void stopTracking() {
-	synchronized (trackingLock) {
-		objects = null;
-		errors = null;
-		trackingLock = null;
-	}
+	tracker = null;
 }
 
 
@@ -246,27 +241,16 @@ public void dispose () {
 			destroy ();
 			disposed = true;			
 			if (tracking) {
-				synchronized (trackingLock) {
-					printErrors ();
-					objects = null;
-					errors = null;
-					trackingLock = null;
-				}
+				printErrors ();
+				tracker = null;
 			}
 		}
 	}
 }
 
 void dispose_Object (Object object) {
-	synchronized (trackingLock) {
-		for (int i=0; i<objects.length; i++) {
-			if (objects [i] == object) {
-				objects [i] = null;
-				errors [i] = null;
-				return;
-			}
-		}
-	}
+	AllocationTracker tracker = this.tracker;
+	if (tracker != null) tracker.remove (object);
 }
 
 /**
@@ -321,26 +305,23 @@ public DeviceData getDeviceData () {
 	DeviceData data = new DeviceData ();
 	data.debug = debug;
 	data.tracking = tracking;
-	if (tracking) {
-		synchronized (trackingLock) {
-			int count = 0, length = objects.length;
-			for (int i=0; i<length; i++) {
-				if (objects [i] != null) count++;
-			}
-			int index = 0;
-			data.objects = new Object [count];
-			data.errors = new Error [count];
-			for (int i=0; i<length; i++) {
-				if (objects [i] != null) {
-					data.objects [index] = objects [i];
-					data.errors [index] = errors [i];
-					index++;
-				}
-			}
+	AllocationTracker tracker = this.tracker;
+	if (tracking && tracker != null) {
+		Error [][] stacks = new Error [1][];
+		String [][] objectSites = new String [1][];
+		data.objects = tracker.getObjects (stacks, objectSites);
+		data.errors = stacks [0];
+		data.objectSites = objectSites [0];
+		Map<String, Integer> sites = tracker.getAllocationSites ();
+		data.allocationSites = sites.keySet ().toArray (new String [sites.size ()]);
+		data.allocationCounts = new int [data.allocationSites.length];
+		for (int i=0; i<data.allocationSites.length; i++) {
+			data.allocationCounts [i] = sites.get (data.allocationSites [i]);
 		}
 	} else {
 		data.objects = new Object [0];
 		data.errors = new Error [0];
+		data.objectSites = new String [0];
 	}
 	return data;
 }
@@ -693,68 +674,55 @@ public boolean loadFont (String path) {
 }
 
 void new_Object (Object object) {
-	synchronized (trackingLock) {
-		for (int i=0; i<objects.length; i++) {
-			if (objects [i] == null) {
-				objects [i] = object;
-				errors [i] = new Error ();
-				return;
-			}
-		}
-		Object [] newObjects = new Object [objects.length + 128];
-		System.arraycopy (objects, 0, newObjects, 0, objects.length);
-		newObjects [objects.length] = object;
-		objects = newObjects;
-		Error [] newErrors = new Error [errors.length + 128];
-		System.arraycopy (errors, 0, newErrors, 0, errors.length);
-		newErrors [errors.length] = new Error ();
-		errors = newErrors;
-	}
+	AllocationTracker tracker = this.tracker;
+	if (tracker != null) tracker.add (object);
 }
 
 void printErrors () {
 	if (!DEBUG) return;
 	if (tracking) {
-		synchronized (trackingLock) {
-			if (objects == null || errors == null) return;
-			int objectCount = 0;
-			int colors = 0, cursors = 0, fonts = 0, gcs = 0, images = 0;
-			int paths = 0, patterns = 0, regions = 0, textLayouts = 0, transforms = 0;
-			for (int i=0; i<objects.length; i++) {
-				Object object = objects [i];
-				if (object != null) {
-					objectCount++;
-					if (object instanceof Color) colors++;
-					if (object instanceof Cursor) cursors++;
-					if (object instanceof Font) fonts++;
-					if (object instanceof GC) gcs++;
-					if (object instanceof Image) images++;
-					if (object instanceof Path) paths++;
-					if (object instanceof Pattern) patterns++;
-					if (object instanceof Region) regions++;
-					if (object instanceof TextLayout) textLayouts++;
-					if (object instanceof Transform) transforms++;
-				}
+		AllocationTracker tracker = this.tracker;
+		if (tracker == null) return;
+		Error [][] stacks = new Error [1][];
+		Object [] objects = tracker.getObjects (stacks);
+		Error [] errors = stacks [0];
+		int objectCount = 0;
+		int colors = 0, cursors = 0, fonts = 0, gcs = 0, images = 0;
+		int paths = 0, patterns = 0, regions = 0, textLayouts = 0, transforms = 0;
+		for (int i=0; i<objects.length; i++) {
+			Object object = objects [i];
+			if (object != null) {
+				objectCount++;
+				if (object instanceof Color) colors++;
+				if (object instanceof Cursor) cursors++;
+				if (object instanceof Font) fonts++;
+				if (object instanceof GC) gcs++;
+				if (object instanceof Image) images++;
+				if (object instanceof Path) paths++;
+				if (object instanceof Pattern) patterns++;
+				if (object instanceof Region) regions++;
+				if (object instanceof TextLayout) textLayouts++;
+				if (object instanceof Transform) transforms++;
 			}
-			if (objectCount != 0) {
-				String string = "Summary: ";
-				if (colors != 0) string += colors + " Color(s), ";
-				if (cursors != 0) string += cursors + " Cursor(s), ";
-				if (fonts != 0) string += fonts + " Font(s), ";
-				if (gcs != 0) string += gcs + " GC(s), ";
-				if (images != 0) string += images + " Image(s), ";
-				if (paths != 0) string += paths + " Path(s), ";
-				if (patterns != 0) string += patterns + " Pattern(s), ";
-				if (regions != 0) string += regions + " Region(s), ";
-				if (textLayouts != 0) string += textLayouts + " TextLayout(s), ";
-				if (transforms != 0) string += transforms + " Transforms(s), ";
-				if (string.length () != 0) {
-					string = string.substring (0, string.length () - 2);
-					System.out.println (string);
-				}
-				for (int i=0; i<errors.length; i++) {
-					if (errors [i] != null) errors [i].printStackTrace (System.out);
-				}
+		}
+		if (objectCount != 0) {
+			String string = "Summary: ";
+			if (colors != 0) string += colors + " Color(s), ";
+			if (cursors != 0) string += cursors + " Cursor(s), ";
+			if (fonts != 0) string += fonts + " Font(s), ";
+			if (gcs != 0) string += gcs + " GC(s), ";
+			if (images != 0) string += images + " Image(s), ";
+			if (paths != 0) string += paths + " Path(s), ";
+			if (patterns != 0) string += patterns + " Pattern(s), ";
+			if (regions != 0) string += regions + " Region(s), ";
+			if (textLayouts != 0) string += textLayouts + " TextLayout(s), ";
+			if (transforms != 0) string += transforms + " Transforms(s), ";
+			if (string.length () != 0) {
+				string = string.substring (0, string.length () - 2);
+				System.out.println (string);
+			}
+			for (int i=0; i<errors.length; i++) {
+				if (errors [i] != AllocationTracker.NOT_SAMPLED) errors [i].printStackTrace (System.out);
 			}
 		}
 	}
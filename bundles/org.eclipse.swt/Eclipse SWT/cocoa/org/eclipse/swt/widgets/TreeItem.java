@@ -1,5 +1,5 @@
 /*******************************************************************************
- * Copyright (c) 2000, 2021 IBM Corporation and others.
+ * Copyright (c) 2000, 2026 IBM Corporation and others.
  *
  * This program and the accompanying materials
  * are made available under the terms of the Eclipse Public License 2.0
@@ -1158,6 +1158,61 @@ public void setExpanded (boolean expanded) {
 	}
 }
 
+/**
+ * Sets the expanded state of the receiver and of all its descendants.
+ * <p>
+ * A single <code>SWT.Expand</code> or <code>SWT.Collapse</code> event is sent
+ * for the receiver before the state changes, with the detail field set to
+ * <code>SWT.ALL</code>. Listeners that create the children of an item when
+ * it is expanded must create the whole subtree in response to this event.
+ * </p><p>
+ * When <code>preload</code> is <code>true</code> and the tree was created
+ * with the <code>SWT.VIRTUAL</code> style, the items of the subtree are
+ * created and their data is requested before the subtree is shown, instead
+ * of one by one while the rows are drawn.
+ * </p>
+ *
+ * @param expanded the new expanded state
+ * @param preload whether to request the data of the items of a virtual subtree up front
+ *
+ * @exception SWTException <ul>
+ *    <li>ERROR_WIDGET_DISPOSED - if the receiver has been disposed</li>
+ *    <li>ERROR_THREAD_INVALID_ACCESS - if not called from the thread that created the receiver</li>
+ * </ul>
+ *
+ * @see #setExpanded(boolean)
+ *
+ * @since 3.122
+ */
+public void setSubtreeExpanded (boolean expanded, boolean preload) {
+	checkWidget ();
+	Event event = new Event ();
+	event.item = this;
+	event.detail = SWT.ALL;
+	parent.sendEvent (expanded ? SWT.Expand : SWT.Collapse, event);
+	if (isDisposed ()) return;
+	parent.setRedraw (false);
+	try {
+		setSubtreeExpanded (this, expanded);
+	} finally {
+		if (!parent.isDisposed ()) parent.setRedraw (true);
+	}
+}
+
+/*
+ * Expands the items before their children and collapses them after their
+ * children. Getting the children requests the data of the items of a
+ * virtual tree, so it is always requested up front here.
+ */
+static void setSubtreeExpanded (TreeItem item, boolean expanded) {
+	if (expanded) item.setExpanded (true);
+	for (TreeItem child : item.getItems ()) {
+		if (!child.isDisposed ()) setSubtreeExpanded (child, expanded);
+		if (item.isDisposed ()) return;
+	}
+	if (!expanded) item.setExpanded (false);
+}
+
 /**
  * Sets the font that the receiver will use to paint textual information
  * for this item to the font specified by the argument, or to the default font
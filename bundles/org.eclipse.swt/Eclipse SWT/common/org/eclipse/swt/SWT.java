@@ -1,5 +1,5 @@
 /*******************************************************************************
- * Copyright (c) 2000, 2021 IBM Corporation and others.
+ * Copyright (c) 2000, 2026 IBM Corporation and others.
  *
  * This program and the accompanying materials
  * are made available under the terms of the Eclipse Public License 2.0
@@ -359,6 +359,9 @@ public class SWT {
 	 * </p>
 	 * <ul>
 	 * <li>Event.item: the TreeItem which gets expanded</li>
+	 * <li>Event.detail: SWT.ALL if the whole subtree below the item gets
+	 * expanded by <code>TreeItem.setSubtreeExpanded</code>, in which case no
+	 * event is sent for the items below it, and 0 otherwise (since 3.122)</li>
 	 * </ul>
 	 *
 	 * @see org.eclipse.swt.widgets.Widget#addListener
@@ -366,6 +369,7 @@ public class SWT {
 	 * @see org.eclipse.swt.widgets.Event
 	 *
 	 * @see org.eclipse.swt.widgets.Tree#addTreeListener
+	 * @see org.eclipse.swt.widgets.TreeItem#setSubtreeExpanded(boolean, boolean)
 	 * @see org.eclipse.swt.events.TreeListener#treeExpanded
 	 * @see org.eclipse.swt.events.TreeEvent
 	 */
@@ -379,6 +383,9 @@ public class SWT {
 	 * </p>
 	 * <ul>
 	 * <li>Event.item: the TreeItem which gets collapsed</li>
+	 * <li>Event.detail: SWT.ALL if the whole subtree below the item gets
+	 * collapsed by <code>TreeItem.setSubtreeExpanded</code>, in which case no
+	 * event is sent for the items below it, and 0 otherwise (since 3.122)</li>
 	 * </ul>
 	 *
 	 * @see org.eclipse.swt.widgets.Widget#addListener
@@ -386,6 +393,7 @@ public class SWT {
 	 * @see org.eclipse.swt.widgets.Event
 	 *
 	 * @see org.eclipse.swt.widgets.Tree#addTreeListener
+	 * @see org.eclipse.swt.widgets.TreeItem#setSubtreeExpanded(boolean, boolean)
 	 * @see org.eclipse.swt.events.TreeListener#treeCollapsed
 	 * @see org.eclipse.swt.events.TreeEvent
 	 */
@@ -4567,9 +4575,11 @@ public class SWT {
 	 * <p><b>Used By:</b></p>
 	 * <ul>
 	 * <li><code>Composite</code> layout</li>
+	 * <li><code>Tree</code> Expand and Collapse event detail</li>
 	 * </ul>
 	 *
 	 * @see org.eclipse.swt.widgets.Composite#layout(org.eclipse.swt.widgets.Control[], int)
+	 * @see org.eclipse.swt.widgets.TreeItem#setSubtreeExpanded(boolean, boolean)
 	 *
 	 * @since 3.6
 	 */
@@ -1,5 +1,5 @@
 /*******************************************************************************
- * Copyright (c) 2000, 2010 IBM Corporation and others.
+ * Copyright (c) 2000, 2026 IBM Corporation and others.
  *
  * This program and the accompanying materials
  * are made available under the terms of the Eclipse Public License 2.0
@@ -13,6 +13,10 @@
  *******************************************************************************/
 package org.eclipse.swt.graphics;
 
+import java.lang.ref.*;
+import java.util.*;
+import java.util.concurrent.*;
+import java.util.concurrent.atomic.*;
 import java.util.function.*;
 
 import org.eclipse.swt.*;
@@ -43,44 +47,85 @@ import org.eclipse.swt.*;
 public abstract class Resource {
 
 	/**
-	 * Used to track not disposed SWT resource. A separate class allows
-	 * not to have the {@link #finalize} when tracking is disabled, avoiding
-	 * possible performance issues in GC.
+	 * Used to track not disposed SWT resource. The tracker is registered
+	 * with a {@link Cleaner} and must not reference the resource, so the
+	 * resource marks it when it is disposed.
 	 */
-	private static class ResourceTracker {
+	private static class ResourceTracker implements Runnable {
+		static final Cleaner CLEANER = Cleaner.create();
+
 		/**
-		 * Resource that is tracked here
+		 * Leak counters of the type of the tracked Resource
 		 */
-		private Resource resource;
+		final TrackingStats stats;
 
 		/**
 		 * Recorded at Resource creation if {@link #setNonDisposeHandler} was
-		 * enabled, used to track resource disposal
+		 * enabled, shared by all resources allocated at the same call site
 		 */
-		private Error allocationStack;
+		final Error allocationStack;
 
 		/**
-		 * Allows to ignore specific Resources even if they are not disposed
-		 * properly, used for example for Fonts that SWT doesn't own.
+		 * Set when the Resource is disposed, or when it should be ignored
+		 * even if it is not disposed properly, used for example for Fonts
+		 * that SWT doesn't own.
 		 */
-		boolean ignoreMe;
+		volatile boolean ignoreMe;
+
+		Cleaner.Cleanable cleanable;
 
-		ResourceTracker(Resource resource, Error allocationStack) {
-			this.resource = resource;
+		ResourceTracker(TrackingStats stats, Error allocationStack) {
+			this.stats = stats;
 			this.allocationStack = allocationStack;
 		}
 
 		@Override
-		protected void finalize() {
+		public void run() {
+			stats.tracked.decrementAndGet();
 			if (ignoreMe) return;
-			if (nonDisposedReporter == null) return;
 
-			// If the Resource is GC'ed before it was disposed, this is a leak.
-			if (!resource.isDisposed())
-				nonDisposedReporter.accept(allocationStack);
+			// The Resource was GC'ed before it was disposed, this is a leak.
+			stats.leaked.incrementAndGet();
+			Consumer<Error> reporter = nonDisposedReporter;
+			if (reporter != null) reporter.accept(allocationStack);
+		}
+	}
+
+	/**
+	 * The first frame outside of the SWT graphics code that allocated a
+	 * tracked Resource
+	 */
+	private static final class CallSite {
+		final String className, methodName;
+		final int byteCodeIndex;
+
+		CallSite(StackWalker.StackFrame frame) {
+			className = frame.getClassName();
+			methodName = frame.getMethodName();
+			byteCodeIndex = frame.getByteCodeIndex();
+		}
+
+		@Override
+		public boolean equals(Object object) {
+			if (!(object instanceof CallSite)) return false;
+			CallSite site = (CallSite) object;
+			return byteCodeIndex == site.byteCodeIndex && className.equals(site.className) && methodName.equals(site.methodName);
+		}
+
+		@Override
+		public int hashCode() {
+			return (className.hashCode() * 31 + methodName.hashCode()) * 31 + byteCodeIndex;
 		}
 	}
 
+	/**
+	 * Counters of tracked and leaked resources of one type
+	 */
+	private static class TrackingStats {
+		final AtomicInteger tracked = new AtomicInteger();
+		final AtomicInteger leaked = new AtomicInteger();
+	}
+
 	/**
 	 * the device where this resource was created
 	 */
@@ -96,6 +141,24 @@ public abstract class Resource {
 	 */
 	private ResourceTracker tracker;
 
+	/**
+	 * Only every Nth resource is tracked, 1 tracks all resources
+	 */
+	private static volatile int trackingSampleRate = Math.max(1, Integer.getInteger("org.eclipse.swt.graphics.Resource.reportNonDisposed.sampleRate", 1)); //$NON-NLS-1$
+
+	/**
+	 * The maximum number of resources of one type that are tracked at
+	 * the same time, 0 for no limit
+	 */
+	private static volatile int trackingTypeBudget = Math.max(0, Integer.getInteger("org.eclipse.swt.graphics.Resource.reportNonDisposed.typeBudget", 0)); //$NON-NLS-1$
+
+	private static final int MAX_CALL_SITES = 4096;
+	private static final String GRAPHICS_PACKAGE = "org.eclipse.swt.graphics."; //$NON-NLS-1$
+	private static final StackWalker WALKER = StackWalker.getInstance();
+	private static final AtomicLong trackingCount = new AtomicLong();
+	private static final Map<Class<?>, TrackingStats> trackingStats = new ConcurrentHashMap<>();
+	private static final Map<CallSite, Error> callSiteStacks = new ConcurrentHashMap<>();
+
 	static {
 		boolean trackingEnabled = Boolean.getBoolean("org.eclipse.swt.graphics.Resource.reportNonDisposed"); //$NON-NLS-1$
 		if (trackingEnabled) {
@@ -133,6 +196,11 @@ public void dispose() {
 	if (device == null) return;
 	if (device.isDisposed()) return;
 	destroy();
+	if (tracker != null) {
+		tracker.ignoreMe = true;
+		tracker.cleanable.clean();
+		tracker = null;
+	}
 	if (device.tracking) device.dispose_Object(this);
 	device = null;
 }
@@ -154,6 +222,8 @@ public Device getDevice() {
 void ignoreNonDisposed() {
 	if (tracker != null) {
 		tracker.ignoreMe = true;
+		tracker.cleanable.clean();
+		tracker = null;
 	}
 }
 
@@ -165,17 +235,47 @@ void initNonDisposeTracking() {
 	// Color doesn't really have any resource to be leaked, ignore.
 	if (this instanceof Color) return;
 
-	// Avoid performance costs of having '.finalize()' when not tracking.
+	// Avoid performance costs of registering with the Cleaner when not tracking.
 	if (nonDisposedReporter == null) return;
 
-	// Capture a stack trace to help investigating the leak
-	Error error = new Error("SWT Resource was not properly disposed"); //$NON-NLS-1$
+	// Only track a sample of the resources when sampling is enabled
+	if (trackingSampleRate > 1 && trackingCount.getAndIncrement() % trackingSampleRate != 0) return;
+
+	// Stay within the budget of tracked resources of this type
+	TrackingStats stats = trackingStats.computeIfAbsent(getClass(), type -> new TrackingStats());
+	int budget = trackingTypeBudget;
+	if (stats.tracked.incrementAndGet() > budget && budget > 0) {
+		stats.tracked.decrementAndGet();
+		return;
+	}
+
+	// Register a helper object with the Cleaner, it will do the actual work
+	// of detecting and reporting errors once the Resource is GC'ed. The
+	// helper must not reference the Resource, otherwise it is never GC'ed.
+	tracker = new ResourceTracker(stats, allocationStack());
+	tracker.cleanable = ResourceTracker.CLEANER.register(this, tracker);
+}
 
-	// Allocate a helper class with '.finalize()' in it, it will do the actual
-	// work of detecting and reporting errors. This works because Resource
-	// holds the only reference to 'ResourceTracker' and therefore the tracker
-	// is only GC'ed when Resource itself is ready to be GC'ed.
-	tracker = new ResourceTracker(this, error);
+/*
+* Captures a stack trace to help investigating the leak. Capturing stacks is
+* expensive, so the stack is only captured for the first resource allocated
+* at a call site and is shared by all later resources allocated there.
+*/
+static Error allocationStack() {
+	CallSite site = WALKER.walk(stream -> stream
+		.filter(frame -> !frame.getClassName().startsWith(GRAPHICS_PACKAGE))
+		.findFirst()
+		.map(CallSite::new)
+		.orElse(null));
+	Error error = site != null ? callSiteStacks.get(site) : null;
+	if (error == null) {
+		error = new Error("SWT Resource was not properly disposed"); //$NON-NLS-1$
+		if (site != null && callSiteStacks.size() < MAX_CALL_SITES) {
+			Error previous = callSiteStacks.putIfAbsent(site, error);
+			if (previous != null) error = previous;
+		}
+	}
+	return error;
 }
 
 /**
@@ -208,4 +308,44 @@ public static void setNonDisposeHandler(Consumer<Error> reporter) {
 	nonDisposedReporter = reporter;
 }
 
+/**
+ * Limits the overhead of the detection enabled by
+ * {@link #setNonDisposeHandler(Consumer)}. Only a sample of the resources
+ * is tracked, and at most <code>typeBudget</code> resources of each type
+ * are tracked at the same time.
+ * <p>
+ * The defaults, which track every resource, can also be changed with the
+ * system properties
+ * <code>org.eclipse.swt.graphics.Resource.reportNonDisposed.sampleRate</code>
+ * and <code>org.eclipse.swt.graphics.Resource.reportNonDisposed.typeBudget</code>.
+ * </p>
+ *
+ * @param sampleRate track every <code>sampleRate</code>th resource, 1 tracks all resources
+ * @param typeBudget the maximum number of tracked resources per type, 0 for no limit
+ *
+ * @since 3.122
+ */
+public static void setNonDisposeSampling(int sampleRate, int typeBudget) {
+	trackingSampleRate = Math.max(1, sampleRate);
+	trackingTypeBudget = Math.max(0, typeBudget);
+}
+
+/**
+ * Returns the number of tracked resources that were garbage collected
+ * without being disposed, by type. Only resources that were sampled, see
+ * {@link #setNonDisposeSampling(int, int)}, are counted.
+ *
+ * @return a map from the class name of the resource type to the number of leaked resources
+ *
+ * @since 3.122
+ */
+public static Map<String, Integer> getNonDisposedCounts() {
+	Map<String, Integer> counts = new HashMap<>();
+	trackingStats.forEach((type, stats) -> {
+		int leaked = stats.leaked.get();
+		if (leaked > 0) counts.put(type.getName(), leaked);
+	});
+	return counts;
+}
+
 }
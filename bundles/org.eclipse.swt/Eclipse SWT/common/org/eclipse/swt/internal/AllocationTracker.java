@@ -0,0 +1,228 @@
+/*******************************************************************************
+ * Copyright (c) 2026 IBM Corporation and others.
+ *
+ * This program and the accompanying materials
+ * are made available under the terms of the Eclipse Public License 2.0
+ * which accompanies this distribution, and is available at
+ * https://www.eclipse.org/legal/epl-2.0/
+ *
+ * SPDX-License-Identifier: EPL-2.0
+ *
+ * Contributors:
+ *     IBM Corporation - initial API and implementation
+ *******************************************************************************/
+package org.eclipse.swt.internal;
+
+import java.util.*;
+import java.util.concurrent.atomic.*;
+import java.util.stream.*;
+
+/**
+ * Registry of the graphics objects allocated on a device while
+ * <code>Device.tracking</code> is enabled.
+ * <p>
+ * Objects are kept in an identity hash map, so that registering and
+ * unregistering is constant time. Capturing the allocation stack is the
+ * dominant cost of tracking, so stacks can be sampled (only every Nth
+ * allocation captures a stack) and limited in depth. The allocation site,
+ * the first frame outside of the SWT graphics code, is found by walking the
+ * stack as well, so it is only recorded for sampled allocations, and live
+ * objects are counted per site among those.
+ * </p>
+ * <p>
+ * The defaults, which capture a full stack for every allocation, can be
+ * changed with the system properties
+ * <code>org.eclipse.swt.internal.tracking.sampleRate</code> and
+ * <code>org.eclipse.swt.internal.tracking.stackDepth</code>.
+ * </p>
+ */
+public class AllocationTracker {
+	static final StackWalker WALKER = StackWalker.getInstance ();
+	static final String GRAPHICS_PACKAGE = "org.eclipse.swt.graphics."; //$NON-NLS-1$
+	static final String TRACKER_CLASS = AllocationTracker.class.getName ();
+
+	/** The stack recorded for allocations that were not sampled */
+	public static final Error NOT_SAMPLED = new AllocationStack ("Allocation stack not sampled"); //$NON-NLS-1$
+
+	final Map<Object, Entry> objects = new IdentityHashMap<> ();
+	final Map<String, int []> sites = new HashMap<> ();
+	final AtomicLong allocations = new AtomicLong ();
+	volatile int sampleRate = Math.max (1, Integer.getInteger ("org.eclipse.swt.internal.tracking.sampleRate", 1)); //$NON-NLS-1$
+	volatile int stackDepth = Math.max (0, Integer.getInteger ("org.eclipse.swt.internal.tracking.stackDepth", 0)); //$NON-NLS-1$
+
+	static final Entry UNSAMPLED = new Entry (NOT_SAMPLED, null);
+
+	static final class Entry {
+		final Error stack;
+		final String site;
+
+		Entry (Error stack, String site) {
+			this.stack = stack;
+			this.site = site;
+		}
+	}
+
+	/*
+	* An error whose stack trace is filled from a StackWalker instead
+	* of the expensive native capture in Throwable.fillInStackTrace().
+	*/
+	static final class AllocationStack extends Error {
+		static final long serialVersionUID = 1L;
+
+		AllocationStack (String message) {
+			super (message);
+		}
+
+		@Override
+		public synchronized Throwable fillInStackTrace () {
+			return this;
+		}
+	}
+
+/**
+ * Sets how often an allocation stack is captured.
+ *
+ * @param rate capture the stack of every <code>rate</code>th allocation,
+ *    1 captures all stacks
+ */
+public void setSampleRate (int rate) {
+	sampleRate = Math.max (1, rate);
+}
+
+/**
+ * Sets the maximum number of frames captured per allocation stack.
+ *
+ * @param depth the number of frames, or 0 for complete stacks
+ */
+public void setStackDepth (int depth) {
+	stackDepth = Math.max (0, depth);
+}
+
+/**
+ * Registers a newly allocated object.
+ *
+ * @param object the object
+ */
+public void add (Object object) {
+	if (allocations.getAndIncrement () % sampleRate != 0) {
+		synchronized (this) {
+			objects.put (object, UNSAMPLED);
+		}
+		return;
+	}
+	Error stack = captureStack ();
+	String site = allocationSite ();
+	synchronized (this) {
+		objects.put (object, new Entry (stack, site));
+		sites.computeIfAbsent (site, key -> new int [1]) [0]++;
+	}
+}
+
+/**
+ * Unregisters a disposed object.
+ *
+ * @param object the object
+ */
+public void remove (Object object) {
+	synchronized (this) {
+		Entry entry = objects.remove (object);
+		if (entry == null || entry.site == null) return;
+		int [] count = sites.get (entry.site);
+		if (count != null && --count [0] == 0) sites.remove (entry.site);
+	}
+}
+
+/**
+ * Returns the number of registered objects.
+ *
+ * @return the number of live objects
+ */
+public synchronized int size () {
+	return objects.size ();
+}
+
+/**
+ * Returns the registered objects and their allocation stacks. The stacks
+ * of objects whose allocation was not sampled are {@link #NOT_SAMPLED}.
+ *
+ * @param stacks an array of length one which receives the stacks
+ * @return the live objects
+ */
+public Object [] getObjects (Error [][] stacks) {
+	return getObjects (stacks, null);
+}
+
+/**
+ * Returns the registered objects with their allocation stacks and
+ * allocation sites. The sites of objects whose allocation was not
+ * sampled are <code>null</code>.
+ *
+ * @param stacks an array of length one which receives the stacks
+ * @param sites an array of length one which receives the allocation sites, or <code>null</code>
+ * @return the live objects
+ */
+public synchronized Object [] getObjects (Error [][] stacks, String [][] sites) {
+	Object [] result = new Object [objects.size ()];
+	Error [] errors = new Error [result.length];
+	String [] objectSites = sites != null ? new String [result.length] : null;
+	int index = 0;
+	for (Map.Entry<Object, Entry> entry : objects.entrySet ()) {
+		result [index] = entry.getKey ();
+		errors [index] = entry.getValue ().stack;
+		if (objectSites != null) objectSites [index] = entry.getValue ().site;
+		index++;
+	}
+	stacks [0] = errors;
+	if (sites != null) sites [0] = objectSites;
+	return result;
+}
+
+/**
+ * Returns the number of live objects per allocation site. Only objects
+ * whose allocation was sampled are counted.
+ *
+ * @return a map from allocation site to the number of live objects
+ */
+public synchronized Map<String, Integer> getAllocationSites () {
+	Map<String, Integer> result = new HashMap<> (sites.size () * 2);
+	sites.forEach ((site, count) -> result.put (site, count [0]));
+	return result;
+}
+
+/**
+ * Returns the allocation site of the given registered object.
+ *
+ * @param object the object
+ * @return the allocation site, or <code>null</code> if the object is not
+ *    registered or its allocation was not sampled
+ */
+public synchronized String getAllocationSite (Object object) {
+	Entry entry = objects.get (object);
+	return entry != null ? entry.site : null;
+}
+
+Error captureStack () {
+	int depth = stackDepth;
+	if (depth == 0) return new Error ();
+	List<StackTraceElement> frames = WALKER.walk (stream -> stream
+		.dropWhile (frame -> frame.getClassName ().equals (TRACKER_CLASS))
+		.limit (depth)
+		.map (StackWalker.StackFrame::toStackTraceElement)
+		.collect (Collectors.toList ()));
+	Error stack = new AllocationStack (null);
+	stack.setStackTrace (frames.toArray (new StackTraceElement [frames.size ()]));
+	return stack;
+}
+
+static String allocationSite () {
+	return WALKER.walk (stream -> stream
+		.filter (frame -> {
+			String name = frame.getClassName ();
+			return !name.equals (TRACKER_CLASS) && !name.startsWith (GRAPHICS_PACKAGE);
+		})
+		.findFirst ()
+		.map (frame -> frame.toStackTraceElement ().toString ())
+		.orElse ("<unknown>")); //$NON-NLS-1$
+}
+
+}
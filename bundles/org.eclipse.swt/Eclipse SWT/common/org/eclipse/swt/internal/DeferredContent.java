@@ -0,0 +1,62 @@
+/*******************************************************************************
+ * Copyright (c) 2026 IBM Corporation and others.
+ *
+ * This program and the accompanying materials
+ * are made available under the terms of the Eclipse Public License 2.0
+ * which accompanies this distribution, and is available at
+ * https://www.eclipse.org/legal/epl-2.0/
+ *
+ * SPDX-License-Identifier: EPL-2.0
+ *
+ * Contributors:
+ *     IBM Corporation - initial API and implementation
+ *******************************************************************************/
+package org.eclipse.swt.internal;
+
+/**
+ * Clipboard data that is computed the first time it is requested.
+ * <p>
+ * An instance can be passed to <code>Clipboard.setContents()</code> in
+ * place of the data object of any transfer. It is not validated when it is
+ * set. On platforms that render clipboard formats on demand, it is
+ * computed when a paste target asks for the format, and the result is
+ * validated by the transfer at that point. A format whose value is
+ * <code>null</code> or not valid for its transfer is not provided.
+ * </p>
+ */
+public abstract class DeferredContent {
+	Object value;
+	boolean computed;
+
+/**
+ * Computes the data. Called at most once, on the user interface thread.
+ *
+ * @return the data, or <code>null</code> if it is not available
+ */
+protected abstract Object compute ();
+
+/**
+ * Returns the data, computing it on the first call.
+ *
+ * @return the data, or <code>null</code> if it is not available
+ */
+public final synchronized Object get () {
+	if (!computed) {
+		value = compute ();
+		computed = true;
+	}
+	return value;
+}
+
+/**
+ * Returns the data of a deferred content object, or the argument itself
+ * for any other object.
+ *
+ * @param data clipboard data
+ * @return the resolved data
+ */
+public static Object resolve (Object data) {
+	return data instanceof DeferredContent ? ((DeferredContent) data).get () : data;
+}
+
+}
@@ -0,0 +1,457 @@
+/*******************************************************************************
+ * Copyright (c) 2026 IBM Corporation and others.
+ *
+ * This program and the accompanying materials
+ * are made available under the terms of the Eclipse Public License 2.0
+ * which accompanies this distribution, and is available at
+ * https://www.eclipse.org/legal/epl-2.0/
+ *
+ * SPDX-License-Identifier: EPL-2.0
+ *
+ * Contributors:
+ *     IBM Corporation - initial API and implementation
+ *******************************************************************************/
+package org.eclipse.swt.internal;
+
+import java.util.*;
+
+/**
+ * Records how long the user-interface thread spends dispatching events and
+ * detects stalls, dispatches that run longer than a threshold.
+ * <p>
+ * Durations are recorded in histograms per SWT event type, per listener
+ * class, per native event type and per native signal, together with the
+ * time asyncExec runnables wait before they run. Dispatches nest, a native
+ * event emits signals which send SWT events, so the time of an inner
+ * dispatch is also counted in the outer ones. A watchdog thread captures the stack of
+ * the user-interface thread when a dispatch exceeds the stall threshold.
+ * </p>
+ * <p>
+ * The histograms are updated by the user-interface thread without locking
+ * and should be read from that thread. The monitor is installed per display,
+ * on GTK with <code>Display.setData ("org.eclipse.swt.internal.gtk.dispatchMonitor", monitor)</code>
+ * or by setting the system property
+ * <code>org.eclipse.swt.internal.dispatchMonitor.stallThreshold</code> to
+ * a threshold in milliseconds.
+ * </p>
+ */
+public class DispatchMonitor {
+	static final int MAX_STALLS = 64;
+	static volatile DispatchMonitor [] monitors = new DispatchMonitor [0];
+
+	final Thread thread;
+	final long thresholdNanos;
+	Histogram [] events = new Histogram [64];
+	Histogram [] nativeEvents = new Histogram [64];
+	Histogram [] signals = new Histogram [128];
+	final Map<Class<?>, Histogram> listeners = new HashMap<> ();
+	final Histogram asyncExecWait = new Histogram ();
+	final Histogram asyncExecRun = new Histogram ();
+	final Deque<Stall> stalls = new ArrayDeque<> ();
+	int stallCount;
+
+	/* Written by the user-interface thread, read by the watchdog */
+	volatile int depth, currentType;
+	volatile boolean sleeping;
+	volatile long activity;
+	volatile Thread watchdog;
+
+/**
+ * A histogram of durations in nanoseconds. Values are counted in buckets
+ * whose width grows with the value (32 buckets per power of two), so that
+ * percentiles are accurate to about 3% over the whole range.
+ */
+public static final class Histogram {
+	static final int SUB_BUCKET_BITS = 5;
+	static final int SUB_BUCKETS = 1 << SUB_BUCKET_BITS;
+	/* Values above 2^40 ns (about 18 minutes) are clamped */
+	static final long MAX_VALUE = (1L << 40) - 1;
+
+	final long [] counts = new long [(40 - SUB_BUCKET_BITS + 1) * SUB_BUCKETS];
+	long count, total, max;
+
+	static int index (long value) {
+		if (value < SUB_BUCKETS) return (int) value;
+		int shift = 63 - Long.numberOfLeadingZeros (value) - SUB_BUCKET_BITS;
+		return (shift + 1) * SUB_BUCKETS + (int) ((value >>> shift) & (SUB_BUCKETS - 1));
+	}
+
+	static long highestValue (int index) {
+		if (index < SUB_BUCKETS) return index;
+		int shift = index / SUB_BUCKETS - 1;
+		return ((SUB_BUCKETS + (long) (index % SUB_BUCKETS) + 1) << shift) - 1;
+	}
+
+	void record (long nanos) {
+		long value = Math.min (Math.max (0, nanos), MAX_VALUE);
+		counts [index (value)]++;
+		count++;
+		total += value;
+		if (value > max) max = value;
+	}
+
+	/**
+	 * Returns the number of recorded durations.
+	 *
+	 * @return the count
+	 */
+	public long getCount () {
+		return count;
+	}
+
+	/**
+	 * Returns the sum of the recorded durations.
+	 *
+	 * @return the total in nanoseconds
+	 */
+	public long getTotal () {
+		return total;
+	}
+
+	/**
+	 * Returns the longest recorded duration.
+	 *
+	 * @return the maximum in nanoseconds
+	 */
+	public long getMax () {
+		return max;
+	}
+
+	/**
+	 * Returns the mean of the recorded durations.
+	 *
+	 * @return the mean in nanoseconds, or 0 if nothing was recorded
+	 */
+	public long getMean () {
+		return count == 0 ? 0 : total / count;
+	}
+
+	/**
+	 * Returns the duration below which the given percentage of the
+	 * recorded durations fall.
+	 *
+	 * @param percentile the percentile, from 0 to 100
+	 * @return the duration in nanoseconds, or 0 if nothing was recorded
+	 */
+	public long getValueAtPercentile (double percentile) {
+		if (count == 0) return 0;
+		long target = Math.max (1, (long) Math.ceil (count * Math.min (100, Math.max (0, percentile)) / 100));
+		long seen = 0;
+		for (int i = 0; i < counts.length; i++) {
+			seen += counts [i];
+			if (seen >= target) return Math.min (highestValue (i), max);
+		}
+		return max;
+	}
+
+	void reset () {
+		Arrays.fill (counts, 0);
+		count = total = max = 0;
+	}
+}
+
+/**
+ * A dispatch that exceeded the stall threshold.
+ */
+public static final class Stall {
+	/** The SWT event type, native event type or signal that was being dispatched */
+	public final int eventType;
+	/** How long the dispatch had been running when the stack was captured, in nanoseconds */
+	public final long duration;
+	/** The stack of the user-interface thread */
+	public final StackTraceElement [] stack;
+
+	Stall (int eventType, long duration, StackTraceElement [] stack) {
+		this.eventType = eventType;
+		this.duration = duration;
+		this.stack = stack;
+	}
+}
+
+/**
+ * Creates a monitor for the given user-interface thread.
+ *
+ * @param thread the user-interface thread
+ * @param stallThreshold the stall threshold in milliseconds, or 0 to only record histograms
+ */
+public DispatchMonitor (Thread thread, int stallThreshold) {
+	this.thread = thread;
+	this.thresholdNanos = Math.max (0, stallThreshold) * 1_000_000L;
+}
+
+/**
+ * Returns the installed monitor of the current thread.
+ *
+ * @return the monitor, or <code>null</code>
+ */
+public static DispatchMonitor current () {
+	DispatchMonitor [] monitors = DispatchMonitor.monitors;
+	if (monitors.length == 0) return null;
+	Thread thread = Thread.currentThread ();
+	for (DispatchMonitor monitor : monitors) {
+		if (monitor.thread == thread) return monitor;
+	}
+	return null;
+}
+
+/**
+ * Starts recording and, when a stall threshold is set, the watchdog.
+ */
+public void install () {
+	synchronized (DispatchMonitor.class) {
+		for (DispatchMonitor monitor : monitors) {
+			if (monitor == this) return;
+		}
+		DispatchMonitor [] newMonitors = Arrays.copyOf (monitors, monitors.length + 1);
+		newMonitors [monitors.length] = this;
+		monitors = newMonitors;
+	}
+	if (thresholdNanos > 0) {
+		watchdog = new Thread (this::watch, "SWT Dispatch Monitor"); //$NON-NLS-1$
+		watchdog.setDaemon (true);
+		watchdog.start ();
+	}
+}
+
+/**
+ * Stops recording and the watchdog. The recorded data remains available.
+ */
+public void uninstall () {
+	synchronized (DispatchMonitor.class) {
+		DispatchMonitor [] newMonitors = new DispatchMonitor [monitors.length];
+		int count = 0;
+		for (DispatchMonitor monitor : monitors) {
+			if (monitor != this) newMonitors [count++] = monitor;
+		}
+		monitors = Arrays.copyOf (newMonitors, count);
+	}
+	Thread watchdog = this.watchdog;
+	this.watchdog = null;
+	if (watchdog != null) watchdog.interrupt ();
+}
+
+/**
+ * Marks the start of a dispatch on the user-interface thread.
+ *
+ * @param type the event type
+ * @return the start time, to be passed to the matching end method
+ */
+public long begin (int type) {
+	long now = System.nanoTime ();
+	currentType = type;
+	activity = now;
+	depth++;
+	return now;
+}
+
+/**
+ * Marks the end of the dispatch of an SWT event.
+ *
+ * @param type the SWT event type
+ * @param start the value returned by {@link #begin(int)}
+ */
+public void endEvent (int type, long start) {
+	events = record (events, type, end (start));
+}
+
+/**
+ * Marks the end of the dispatch of a native event.
+ *
+ * @param type the native event type
+ * @param start the value returned by {@link #begin(int)}
+ */
+public void endNativeEvent (int type, long start) {
+	nativeEvents = record (nativeEvents, type, end (start));
+}
+
+/**
+ * Marks the end of the dispatch of a native signal to a widget.
+ *
+ * @param signal the platform specific signal identifier
+ * @param start the value returned by {@link #begin(int)}
+ */
+public void endSignal (int signal, long start) {
+	signals = record (signals, signal, end (start));
+}
+
+/**
+ * Records the time a listener spent handling an event.
+ *
+ * @param listener the listener, or the listener it wraps
+ * @param start the value of {@link System#nanoTime()} before the listener was called
+ */
+public void endListener (Object listener, long start) {
+	listeners.computeIfAbsent (listener.getClass (), type -> new Histogram ()).record (System.nanoTime () - start);
+}
+
+/**
+ * Marks the end of an asyncExec runnable.
+ *
+ * @param enqueueTime the time the runnable was queued
+ * @param start the value returned by {@link #begin(int)}
+ */
+public void endAsyncExec (long enqueueTime, long start) {
+	asyncExecWait.record (start - enqueueTime);
+	asyncExecRun.record (end (start));
+}
+
+/**
+ * Marks that the user-interface thread waits for events, which is not
+ * a stall even when it happens inside of a dispatch.
+ *
+ * @param sleeping <code>true</code> when the thread starts waiting and
+ *    <code>false</code> when it wakes up
+ */
+public void sleep (boolean sleeping) {
+	activity = System.nanoTime ();
+	this.sleeping = sleeping;
+}
+
+long end (long start) {
+	long now = System.nanoTime ();
+	activity = now;
+	depth--;
+	return now - start;
+}
+
+static Histogram [] record (Histogram [] histograms, int type, long nanos) {
+	if (type < 0) return histograms;
+	if (type >= histograms.length) histograms = Arrays.copyOf (histograms, Math.max (type + 1, histograms.length * 2));
+	Histogram histogram = histograms [type];
+	if (histogram == null) histogram = histograms [type] = new Histogram ();
+	histogram.record (nanos);
+	return histograms;
+}
+
+void watch () {
+	long period = Math.max (1_000_000L, thresholdNanos / 4);
+	long reported = 0;
+	while (watchdog == Thread.currentThread ()) {
+		try {
+			Thread.sleep (period / 1_000_000L);
+		} catch (InterruptedException e) {
+			return;
+		}
+		long activity = this.activity;
+		if (depth <= 0 || sleeping || activity == reported) continue;
+		int type = currentType;
+		long duration = System.nanoTime () - activity;
+		if (duration < thresholdNanos) continue;
+		StackTraceElement [] stack = thread.getStackTrace ();
+		/* Ignore the stack if the dispatch ended while it was captured */
+		if (activity != this.activity) continue;
+		reported = activity;
+		synchronized (stalls) {
+			if (stalls.size () == MAX_STALLS) stalls.removeFirst ();
+			stalls.addLast (new Stall (type, duration, stack));
+			stallCount++;
+		}
+	}
+}
+
+/**
+ * Returns the histogram of the dispatch durations of an SWT event type.
+ *
+ * @param type the SWT event type
+ * @return the histogram, or <code>null</code> if no event of the type was dispatched
+ */
+public Histogram getEventHistogram (int type) {
+	return type >= 0 && type < events.length ? events [type] : null;
+}
+
+/**
+ * Returns the histogram of the dispatch durations of a native event type.
+ *
+ * @param type the native event type
+ * @return the histogram, or <code>null</code> if no event of the type was dispatched
+ */
+public Histogram getNativeEventHistogram (int type) {
+	return type >= 0 && type < nativeEvents.length ? nativeEvents [type] : null;
+}
+
+/**
+ * Returns the histogram of the dispatch durations of a native signal.
+ *
+ * @param signal the platform specific signal identifier
+ * @return the histogram, or <code>null</code> if the signal was not dispatched
+ */
+public Histogram getSignalHistogram (int signal) {
+	return signal >= 0 && signal < signals.length ? signals [signal] : null;
+}
+
+/**
+ * Returns the histograms of the time listeners spent handling events,
+ * by listener class. Typed listeners are reported by the class of the
+ * listener they wrap.
+ *
+ * @return a map from listener class to histogram
+ */
+public Map<Class<?>, Histogram> getListenerHistograms () {
+	return Collections.unmodifiableMap (listeners);
+}
+
+/**
+ * Returns the histogram of the time asyncExec runnables waited in the
+ * queue before they ran.
+ *
+ * @return the histogram
+ */
+public Histogram getAsyncExecWaitHistogram () {
+	return asyncExecWait;
+}
+
+/**
+ * Returns the histogram of the time asyncExec runnables ran.
+ *
+ * @return the histogram
+ */
+public Histogram getAsyncExecRunHistogram () {
+	return asyncExecRun;
+}
+
+/**
+ * Returns the most recent stalls, the oldest first.
+ *
+ * @return the stalls
+ */
+public Stall [] getStalls () {
+	synchronized (stalls) {
+		return stalls.toArray (new Stall [stalls.size ()]);
+	}
+}
+
+/**
+ * Returns the number of stalls detected since the monitor was created
+ * or reset, including the ones no longer returned by {@link #getStalls()}.
+ *
+ * @return the number of stalls
+ */
+public int getStallCount () {
+	synchronized (stalls) {
+		return stallCount;
+	}
+}
+
+/**
+ * Clears the histograms and the stalls.
+ */
+public void reset () {
+	for (Histogram histogram : events) {
+		if (histogram != null) histogram.reset ();
+	}
+	for (Histogram histogram : nativeEvents) {
+		if (histogram != null) histogram.reset ();
+	}
+	for (Histogram histogram : signals) {
+		if (histogram != null) histogram.reset ();
+	}
+	listeners.clear ();
+	asyncExecWait.reset ();
+	asyncExecRun.reset ();
+	synchronized (stalls) {
+		stalls.clear ();
+		stallCount = 0;
+	}
+}
+
+}
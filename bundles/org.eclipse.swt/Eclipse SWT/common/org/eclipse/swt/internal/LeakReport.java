@@ -0,0 +1,281 @@
+/*******************************************************************************
+ * Copyright (c) 2026 IBM Corporation and others.
+ *
+ * This program and the accompanying materials
+ * are made available under the terms of the Eclipse Public License 2.0
+ * which accompanies this distribution, and is available at
+ * https://www.eclipse.org/legal/epl-2.0/
+ *
+ * SPDX-License-Identifier: EPL-2.0
+ *
+ * Contributors:
+ *     IBM Corporation - initial API and implementation
+ *******************************************************************************/
+package org.eclipse.swt.internal;
+
+import java.io.*;
+import java.nio.charset.*;
+import java.util.*;
+
+import org.eclipse.swt.graphics.*;
+
+/**
+ * Groups the resources tracked by a device by type and allocation site,
+ * computes the difference between two snapshots and writes the result as
+ * JSON or CSV. This is the headless counterpart of the Sleak view, usable
+ * from tests and scripts:
+ * <pre>
+ * LeakReport.Snapshot before = LeakReport.Snapshot.capture (display);
+ * runScenario ();
+ * LeakReport report = LeakReport.between (before, LeakReport.Snapshot.capture (display));
+ * report.write (new File ("leaks.json"));
+ * </pre>
+ * The device must have been created with, or switched to, tracking enabled.
+ * The allocation sites are the ones recorded by the device's allocation
+ * tracker. Objects whose allocation was not sampled are reported under an
+ * unknown site.
+ */
+public class LeakReport {
+	static final String UNKNOWN_SITE = "<unknown>"; //$NON-NLS-1$
+
+	final List<Group> groups;
+	final int liveCount, createdCount, disposedCount;
+
+/**
+ * The resources of one type that were allocated at the same site.
+ */
+public static final class Group {
+	/** The simple class name of the resources */
+	public final String type;
+	/** The first caller outside of the SWT graphics code */
+	public final String site;
+	/** The number of resources alive in the later snapshot */
+	public int live;
+	/** The number of resources allocated between the snapshots */
+	public int created;
+	/** The number of resources disposed between the snapshots */
+	public int disposed;
+
+	Group (String type, String site) {
+		this.type = type;
+		this.site = site;
+	}
+}
+
+/**
+ * The resources that were alive on a device at one point in time.
+ */
+public static final class Snapshot {
+	final Map<Object, Group> objects;
+
+	Snapshot (Map<Object, Group> objects) {
+		this.objects = objects;
+	}
+
+	/**
+	 * Captures the resources currently tracked by the device.
+	 *
+	 * @param device the device, which should have tracking enabled
+	 * @return the snapshot
+	 */
+	public static Snapshot capture (Device device) {
+		return capture (device.getDeviceData ());
+	}
+
+	/**
+	 * Captures the resources tracked in the device data, so that a caller
+	 * which already retrieved the data does not need to retrieve it again.
+	 *
+	 * @param data the data returned by <code>Device.getDeviceData()</code>
+	 * @return the snapshot
+	 */
+	public static Snapshot capture (DeviceData data) {
+		Map<Object, Group> objects = new IdentityHashMap<> (data.objects.length * 2);
+		Map<String, Group> keys = new HashMap<> ();
+		for (int i = 0; i < data.objects.length; i++) {
+			Object object = data.objects [i];
+			String type = object.getClass ().getSimpleName ();
+			String site = data.objectSites != null && data.objectSites [i] != null ? data.objectSites [i] : UNKNOWN_SITE;
+			Group key = keys.computeIfAbsent (type + '\n' + site, k -> new Group (type, site));
+			objects.put (object, key);
+		}
+		return new Snapshot (objects);
+	}
+
+	/**
+	 * Returns the number of resources in the snapshot.
+	 *
+	 * @return the number of live resources
+	 */
+	public int size () {
+		return objects.size ();
+	}
+}
+
+LeakReport (List<Group> groups) {
+	this.groups = groups;
+	int live = 0, created = 0, disposed = 0;
+	for (Group group : groups) {
+		live += group.live;
+		created += group.created;
+		disposed += group.disposed;
+	}
+	liveCount = live;
+	createdCount = created;
+	disposedCount = disposed;
+}
+
+/**
+ * Returns a report of the resources alive in the snapshot. All of them
+ * are reported as created.
+ *
+ * @param snapshot the snapshot
+ * @return the report
+ */
+public static LeakReport of (Snapshot snapshot) {
+	return between (new Snapshot (Collections.emptyMap ()), snapshot);
+}
+
+/**
+ * Returns a report of the resources that were created and disposed
+ * between the two snapshots, grouped by type and allocation site.
+ *
+ * @param before the earlier snapshot
+ * @param after the later snapshot
+ * @return the report
+ */
+public static LeakReport between (Snapshot before, Snapshot after) {
+	Map<String, Group> groups = new HashMap<> ();
+	after.objects.forEach ((object, key) -> {
+		Group group = group (groups, key);
+		group.live++;
+		if (!before.objects.containsKey (object)) group.created++;
+	});
+	before.objects.forEach ((object, key) -> {
+		if (!after.objects.containsKey (object)) group (groups, key).disposed++;
+	});
+	List<Group> result = new ArrayList<> (groups.values ());
+	result.sort (Comparator.comparingInt ((Group group) -> group.created - group.disposed).reversed ()
+		.thenComparing (Comparator.comparingInt ((Group group) -> group.live).reversed ())
+		.thenComparing (group -> group.type)
+		.thenComparing (group -> group.site));
+	return new LeakReport (result);
+}
+
+static Group group (Map<String, Group> groups, Group key) {
+	return groups.computeIfAbsent (key.type + '\n' + key.site, k -> new Group (key.type, key.site));
+}
+
+/**
+ * Returns the groups of the report, the ones with the largest
+ * growth first.
+ *
+ * @return the groups
+ */
+public List<Group> getGroups () {
+	return Collections.unmodifiableList (groups);
+}
+
+/**
+ * Returns the number of resources alive in the later snapshot.
+ *
+ * @return the number of live resources
+ */
+public int getLiveCount () {
+	return liveCount;
+}
+
+/**
+ * Returns the number of resources created between the snapshots.
+ *
+ * @return the number of created resources
+ */
+public int getCreatedCount () {
+	return createdCount;
+}
+
+/**
+ * Returns the number of resources disposed between the snapshots.
+ *
+ * @return the number of disposed resources
+ */
+public int getDisposedCount () {
+	return disposedCount;
+}
+
+/**
+ * Writes the report to a file, as CSV if the file name ends
+ * with <code>.csv</code> and as JSON otherwise.
+ *
+ * @param file the file
+ * @throws IOException if the file cannot be written
+ */
+public void write (File file) throws IOException {
+	try (Writer writer = new BufferedWriter (new OutputStreamWriter (new FileOutputStream (file), StandardCharsets.UTF_8))) {
+		if (file.getName ().toLowerCase (Locale.ROOT).endsWith (".csv")) { //$NON-NLS-1$
+			writeCsv (writer);
+		} else {
+			writeJson (writer);
+		}
+	}
+}
+
+/**
+ * Writes the report as a JSON object with the totals and
+ * an array of groups.
+ *
+ * @param writer the writer
+ * @throws IOException if writing fails
+ */
+public void writeJson (Writer writer) throws IOException {
+	writer.write ("{\n  \"live\": " + liveCount + ",\n  \"created\": " + createdCount + ",\n  \"disposed\": " + disposedCount + ",\n  \"groups\": ["); //$NON-NLS-1$ //$NON-NLS-2$ //$NON-NLS-3$ //$NON-NLS-4$
+	for (int i = 0; i < groups.size (); i++) {
+		Group group = groups.get (i);
+		writer.write (i == 0 ? "\n" : ",\n"); //$NON-NLS-1$ //$NON-NLS-2$
+		writer.write ("    {\"type\": " + jsonString (group.type) + ", \"site\": " + jsonString (group.site) //$NON-NLS-1$ //$NON-NLS-2$
+			+ ", \"live\": " + group.live + ", \"created\": " + group.created + ", \"disposed\": " + group.disposed + "}"); //$NON-NLS-1$ //$NON-NLS-2$ //$NON-NLS-3$ //$NON-NLS-4$
+	}
+	writer.write ("\n  ]\n}\n"); //$NON-NLS-1$
+}
+
+/**
+ * Writes the report as CSV with a header line and one line per group.
+ *
+ * @param writer the writer
+ * @throws IOException if writing fails
+ */
+public void writeCsv (Writer writer) throws IOException {
+	writer.write ("type,site,live,created,disposed\n"); //$NON-NLS-1$
+	for (Group group : groups) {
+		writer.write (csvString (group.type) + ',' + csvString (group.site) + ',' + group.live + ',' + group.created + ',' + group.disposed + '\n');
+	}
+}
+
+static String jsonString (String value) {
+	StringBuilder buffer = new StringBuilder (value.length () + 2);
+	buffer.append ('"');
+	for (int i = 0; i < value.length (); i++) {
+		char c = value.charAt (i);
+		switch (c) {
+			case '"': buffer.append ("\\\""); break; //$NON-NLS-1$
+			case '\\': buffer.append ("\\\\"); break; //$NON-NLS-1$
+			case '\n': buffer.append ("\\n"); break; //$NON-NLS-1$
+			case '\r': buffer.append ("\\r"); break; //$NON-NLS-1$
+			case '\t': buffer.append ("\\t"); break; //$NON-NLS-1$
+			default:
+				if (c < 0x20) {
+					buffer.append (String.format ("\\u%04x", (int) c)); //$NON-NLS-1$
+				} else {
+					buffer.append (c);
+				}
+		}
+	}
+	return buffer.append ('"').toString ();
+}
+
+static String csvString (String value) {
+	if (value.indexOf (',') == -1 && value.indexOf ('"') == -1 && value.indexOf ('\n') == -1) return value;
+	return '"' + value.replace ("\"", "\"\"") + '"'; //$NON-NLS-1$ //$NON-NLS-2$
+}
+
+}
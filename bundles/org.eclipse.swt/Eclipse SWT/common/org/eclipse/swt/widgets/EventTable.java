@@ -1,5 +1,5 @@
 /*******************************************************************************
- * Copyright (c) 2000, 2011 IBM Corporation and others.
+ * Copyright (c) 2000, 2026 IBM Corporation and others.
  *
  * This program and the accompanying materials
  * are made available under the terms of the Eclipse Public License 2.0
@@ -30,21 +30,39 @@ class EventTable {
 	int level;
 	static final int GROW_SIZE = 4;
 
+	/*
+	* Index from event type to the ascending positions of its listeners
+	* in types/listeners, so that dispatch only visits matching entries.
+	* It is an open-addressed table with linear probing keyed by the type
+	* (0 marks an empty bucket). Positions only move when the table is
+	* compacted, which never happens while an event is being sent, so the
+	* index is updated in place during dispatch and rebuilt lazily after
+	* compaction. The table doubles when it becomes half full.
+	*/
+	int [] indexTypes;
+	int [][] indexPositions;
+	int [] indexCounts;
+	int indexSize, indexModCount;
+	boolean indexValid;
+	static final int INDEX_SIZE = 8;
+
 public Listener [] getListeners (int eventType) {
 	if (types == null) return new Listener [0];
-	int count = 0;
-	for (int type : types) {
-		if (type == eventType) count++;
-	}
-	if (count == 0) return new Listener [0];
-	Listener [] result = new Listener [count];
-	count = 0;
-	for (int i=0; i<types.length; i++) {
-		if (types [i] == eventType) {
-			result [count++] = listeners [i];
+	int bucket = findBucket (eventType);
+	if (bucket == -1) return new Listener [0];
+	int [] positions = indexPositions [bucket];
+	int length = indexCounts [bucket], count = 0;
+	Listener [] result = new Listener [length];
+	for (int i=0; i<length; i++) {
+		int position = positions [i];
+		if (types [position] == eventType) {
+			result [count++] = listeners [position];
 		}
 	}
-	return result;
+	if (count == length) return result;
+	Listener [] newResult = new Listener [count];
+	System.arraycopy (result, 0, newResult, 0, count);
+	return newResult;
 }
 
 public void hook (int eventType, Listener listener) {
@@ -66,32 +84,60 @@ public void hook (int eventType, Listener listener) {
 	}
 	types [index] = eventType;
 	listeners [index] = listener;
+	if (indexValid) addPosition (eventType, index);
 }
 
 public boolean hooks (int eventType) {
 	if (types == null) return false;
-	for (int type : types) {
-		if (type == eventType) return true;
+	int bucket = findBucket (eventType);
+	if (bucket == -1) return false;
+	int [] positions = indexPositions [bucket];
+	for (int i=0; i<indexCounts [bucket]; i++) {
+		if (types [positions [i]] == eventType) return true;
 	}
 	return false;
 }
 
 public void sendEvent (Event event) {
 	if (types == null) return;
+	int bucket = findBucket (event.type);
+	if (bucket == -1) return;
 	level += level >= 0 ? 1 : -1;
-	try (ExceptionStash exceptions = new ExceptionStash ()) {
-		for (int i=0; i<types.length; i++) {
+	ExceptionStash exceptions = null;
+	DispatchMonitor monitor = DispatchMonitor.current ();
+	int eventType = event.type;
+	long start = monitor != null ? monitor.begin (eventType) : 0;
+	try {
+		int last = -1, modCount = indexModCount;
+		int [] positions = indexPositions [bucket];
+		for (int i=0; i<indexCounts [bucket]; i++) {
 			if (event.type == SWT.None) return;
-			if (types [i] == event.type) {
-				Listener listener = listeners [i];
+			int position = positions [i];
+			if (types [position] == eventType) {
+				Listener listener = listeners [position];
 				if (listener != null) {
+					long listenerStart = monitor != null ? System.nanoTime () : 0;
 					try {
 						listener.handleEvent (event);
 					} catch (Error | RuntimeException ex) {
+						if (exceptions == null) exceptions = new ExceptionStash ();
 						exceptions.stash (ex);
+					} finally {
+						if (monitor != null) {
+							monitor.endListener (listener instanceof TypedListener ? ((TypedListener) listener).getEventListener () : listener, listenerStart);
+						}
 					}
 				}
 			}
+			last = position;
+			if (modCount != indexModCount) {
+				/* Listeners were hooked, continue after the last visited position */
+				modCount = indexModCount;
+				bucket = findBucket (eventType);
+				if (bucket == -1) break;
+				positions = indexPositions [bucket];
+				i = nextPosition (positions, indexCounts [bucket], last) - 1;
+			}
 		}
 	} finally {
 		boolean compact = level < 0;
@@ -109,7 +155,10 @@ public void sendEvent (Event event) {
 				types [i] = 0;
 				listeners [i] = null;
 			}
+			indexValid = false;
 		}
+		if (monitor != null) monitor.endEvent (eventType, start);
+		if (exceptions != null) exceptions.close ();
 	}
 }
 
@@ -128,6 +177,7 @@ void remove (int index) {
 		System.arraycopy (types, index + 1, types, index, end - index);
 		System.arraycopy (listeners, index + 1, listeners, index, end - index);
 		index = end;
+		indexValid = false;
 	} else {
 		if (level > 0) level = -level;
 	}
@@ -137,9 +187,13 @@ void remove (int index) {
 
 public void unhook (int eventType, Listener listener) {
 	if (types == null) return;
-	for (int i=0; i<types.length; i++) {
-		if (types [i] == eventType && listeners [i] == listener) {
-			remove (i);
+	int bucket = findBucket (eventType);
+	if (bucket == -1) return;
+	int [] positions = indexPositions [bucket];
+	for (int i=0; i<indexCounts [bucket]; i++) {
+		int position = positions [i];
+		if (types [position] == eventType && listeners [position] == listener) {
+			remove (position);
 			return;
 		}
 	}
@@ -147,12 +201,16 @@ public void unhook (int eventType, Listener listener) {
 
 public void unhook (int eventType, SWTEventListener listener) {
 	if (types == null) return;
-	for (int i=0; i<types.length; i++) {
-		if (types [i] == eventType) {
-			if (listeners [i] instanceof TypedListener) {
-				TypedListener typedListener = (TypedListener) listeners [i];
+	int bucket = findBucket (eventType);
+	if (bucket == -1) return;
+	int [] positions = indexPositions [bucket];
+	for (int i=0; i<indexCounts [bucket]; i++) {
+		int position = positions [i];
+		if (types [position] == eventType) {
+			if (listeners [position] instanceof TypedListener) {
+				TypedListener typedListener = (TypedListener) listeners [position];
 				if (typedListener.getEventListener () == listener) {
-					remove (i);
+					remove (position);
 					return;
 				}
 			}
@@ -160,4 +218,99 @@ public void unhook (int eventType, SWTEventListener listener) {
 	}
 }
 
+void addPosition (int eventType, int position) {
+	int mask = indexTypes.length - 1;
+	int bucket = hash (eventType) & mask;
+	while (indexTypes [bucket] != 0 && indexTypes [bucket] != eventType) {
+		bucket = (bucket + 1) & mask;
+	}
+	if (indexTypes [bucket] == 0) {
+		if ((indexSize + 1) * 2 > indexTypes.length) {
+			rehash (indexTypes.length * 2);
+			addPosition (eventType, position);
+			return;
+		}
+		indexTypes [bucket] = eventType;
+		indexPositions [bucket] = new int [GROW_SIZE];
+		indexSize++;
+	}
+	int [] positions = indexPositions [bucket];
+	int count = indexCounts [bucket];
+	int insert = nextPosition (positions, count, position - 1);
+	/* A slot that was cleared during dispatch may be reused */
+	if (insert < count && positions [insert] == position) return;
+	if (count == positions.length) {
+		int [] newPositions = new int [count + GROW_SIZE];
+		System.arraycopy (positions, 0, newPositions, 0, count);
+		indexPositions [bucket] = positions = newPositions;
+	}
+	System.arraycopy (positions, insert, positions, insert + 1, count - insert);
+	positions [insert] = position;
+	indexCounts [bucket] = count + 1;
+	indexModCount++;
+}
+
+void buildIndex () {
+	indexTypes = new int [INDEX_SIZE];
+	indexPositions = new int [INDEX_SIZE][];
+	indexCounts = new int [INDEX_SIZE];
+	indexSize = 0;
+	indexValid = true;
+	for (int i=0; i<types.length; i++) {
+		if (types [i] != 0) addPosition (types [i], i);
+	}
+	indexModCount++;
+}
+
+/* Moves the buckets to a table of the given length, keeping their positions */
+void rehash (int length) {
+	int [] oldTypes = indexTypes, oldCounts = indexCounts;
+	int [][] oldPositions = indexPositions;
+	indexTypes = new int [length];
+	indexPositions = new int [length][];
+	indexCounts = new int [length];
+	int mask = length - 1;
+	for (int i=0; i<oldTypes.length; i++) {
+		int type = oldTypes [i];
+		if (type == 0) continue;
+		int bucket = hash (type) & mask;
+		while (indexTypes [bucket] != 0) {
+			bucket = (bucket + 1) & mask;
+		}
+		indexTypes [bucket] = type;
+		indexPositions [bucket] = oldPositions [i];
+		indexCounts [bucket] = oldCounts [i];
+	}
+	indexModCount++;
+}
+
+int findBucket (int eventType) {
+	if (!indexValid) buildIndex ();
+	int mask = indexTypes.length - 1;
+	int bucket = hash (eventType) & mask;
+	while (indexTypes [bucket] != 0) {
+		if (indexTypes [bucket] == eventType) return bucket;
+		bucket = (bucket + 1) & mask;
+	}
+	return -1;
+}
+
+static int hash (int eventType) {
+	return eventType * 0x9E3779B9 >>> 16 ^ eventType;
+}
+
+/* Returns the index of the first position greater than the given one */
+static int nextPosition (int [] positions, int count, int position) {
+	int low = 0, high = count;
+	while (low < high) {
+		int mid = (low + high) >>> 1;
+		if (positions [mid] <= position) {
+			low = mid + 1;
+		} else {
+			high = mid;
+		}
+	}
+	return low;
+}
+
 }
@@ -1,5 +1,5 @@
 /*******************************************************************************
- * Copyright (c) 2000, 2011 IBM Corporation and others.
+ * Copyright (c) 2000, 2026 IBM Corporation and others.
  *
  * This program and the accompanying materials
  * are made available under the terms of the Eclipse Public License 2.0
@@ -13,6 +13,7 @@
  *******************************************************************************/
 package org.eclipse.swt.widgets;
 
+import java.util.concurrent.locks.*;
 
 /**
  * Instances of this class are used to ensure that an
@@ -22,9 +23,12 @@ package org.eclipse.swt.widgets;
  */
 
 class RunnableLock {
-	Runnable runnable;
+	volatile Runnable runnable;
 	Thread thread;
 	Throwable throwable;
+	Object key;
+	long enqueueTime;
+	volatile boolean finished;
 
 RunnableLock (Runnable runnable) {
 	this.runnable = runnable;
@@ -47,4 +51,14 @@ void run (Display display) {
 	runnable = null;
 }
 
+/*
+ * Publishes the outcome of run() (or the abort when the display is
+ * released) and wakes the syncExec caller parked on this lock.
+ */
+void finish () {
+	finished = true;
+	Thread waiter = thread;
+	if (waiter != null) LockSupport.unpark (waiter);
+}
+
 }
@@ -1,5 +1,5 @@
 /*******************************************************************************
- * Copyright (c) 2000, 2014 IBM Corporation and others.
+ * Copyright (c) 2000, 2026 IBM Corporation and others.
  *
  * This program and the accompanying materials
  * are made available under the terms of the Eclipse Public License 2.0
@@ -15,9 +15,12 @@ package org.eclipse.swt.widgets;
 
 import java.util.*;
 import java.util.concurrent.*;
+import java.util.concurrent.atomic.*;
+import java.util.concurrent.locks.*;
 
 import org.eclipse.swt.*;
 import org.eclipse.swt.graphics.*;
+import org.eclipse.swt.internal.DispatchMonitor;
 
 /**
  * Instances of this class provide synchronization support
@@ -40,7 +43,44 @@ import org.eclipse.swt.graphics.*;
 public class Synchronizer {
 	Display display;
 	final ConcurrentLinkedQueue<RunnableLock>  messages= new ConcurrentLinkedQueue<>();
-	Thread syncThread;
+	final ConcurrentLinkedQueue<RunnableLock> highMessages = new ConcurrentLinkedQueue<>();
+	final ConcurrentLinkedQueue<RunnableLock> lowMessages = new ConcurrentLinkedQueue<>();
+	final ConcurrentHashMap<Object, RunnableLock> coalescedMessages = new ConcurrentHashMap<>();
+	volatile Thread syncThread;
+	volatile boolean released;
+
+	/* Drain budget, 0 runs a single message per call */
+	long budgetNanos = Math.max (0, Integer.getInteger ("org.eclipse.swt.internal.asyncExecBudget", 0)) * 1000000L; //$NON-NLS-1$
+
+	/* Statistics */
+	final AtomicInteger queueDepth = new AtomicInteger ();
+	volatile int maxQueueDepth;
+	volatile long runCount, totalWaitNanos, maxWaitNanos;
+
+	/**
+	 * Priority of messages that are run before all other pending messages.
+	 *
+	 * @see #asyncExec(Runnable, int)
+	 * @since 3.122
+	 */
+	public static final int PRIORITY_HIGH = 1;
+
+	/**
+	 * Priority of messages posted through {@link #asyncExec(Runnable)} and
+	 * {@link #syncExec(Runnable)}.
+	 *
+	 * @see #asyncExec(Runnable, int)
+	 * @since 3.122
+	 */
+	public static final int PRIORITY_NORMAL = 0;
+
+	/**
+	 * Priority of messages that are only run when no other messages are pending.
+	 *
+	 * @see #asyncExec(Runnable, int)
+	 * @since 3.122
+	 */
+	public static final int PRIORITY_LOW = -1;
 	static final int GROW_SIZE = 4;
 	static final int MESSAGE_LIMIT = 64;
 
@@ -64,19 +104,53 @@ public Synchronizer (Display display) {
  * @param toReceiveTheEvents the synchronizer that will receive the events
  */
 void moveAllEventsTo (Synchronizer toReceiveTheEvents) {
+	moveAllEventsTo (messages, toReceiveTheEvents.messages, toReceiveTheEvents);
+	moveAllEventsTo (highMessages, toReceiveTheEvents.highMessages, toReceiveTheEvents);
+	moveAllEventsTo (lowMessages, toReceiveTheEvents.lowMessages, toReceiveTheEvents);
+	toReceiveTheEvents.coalescedMessages.putAll (coalescedMessages);
+	coalescedMessages.clear ();
+}
+
+void moveAllEventsTo (ConcurrentLinkedQueue<RunnableLock> from, ConcurrentLinkedQueue<RunnableLock> to, Synchronizer toReceiveTheEvents) {
 	// Drain target queue and add it later again to insert at the beginning of the
 	// queue for backward compatibility:
 	java.util.List<RunnableLock> tail = new ArrayList<>();
-	toReceiveTheEvents.messages.removeIf(tail::add);
-	messages.removeIf(toReceiveTheEvents.messages::add);
-	toReceiveTheEvents.messages.addAll(tail);
+	to.removeIf(tail::add);
+	from.removeIf(lock -> {
+		queueDepth.decrementAndGet ();
+		toReceiveTheEvents.queueDepth.incrementAndGet ();
+		return to.add (lock);
+	});
+	to.addAll(tail);
 }
 
-
 void addLast (RunnableLock lock) {
-	boolean wake = messages.isEmpty();
-	messages.add(lock);
-	if (wake) display.wakeThread ();
+	addLast (messages, lock);
+}
+
+void addLast (ConcurrentLinkedQueue<RunnableLock> queue, RunnableLock lock) {
+	boolean wake = isMessagesEmpty();
+	lock.enqueueTime = System.nanoTime ();
+	queue.add(lock);
+	int depth = queueDepth.incrementAndGet ();
+	if (depth > maxQueueDepth) maxQueueDepth = depth;
+	Display display = this.display;
+	if (wake && display != null) display.wakeThread ();
+}
+
+/*
+ * Queues a message posted with a priority or a key through the display,
+ * like asyncExec(Runnable) is, and withdraws it again when the receiver
+ * was released concurrently.
+ */
+void postAsyncMessage (ConcurrentLinkedQueue<RunnableLock> queue, RunnableLock lock) {
+	Display display = this.display;
+	if (released || display == null) SWT.error (SWT.ERROR_DEVICE_DISPOSED);
+	display.postAsyncMessage (() -> addLast (queue, lock));
+	if (released && queue.remove (lock)) {
+		queueDepth.decrementAndGet ();
+		SWT.error (SWT.ERROR_DEVICE_DISPOSED);
+	}
 }
 
 /**
@@ -101,18 +175,163 @@ protected void asyncExec (Runnable runnable) {
 	addLast (new RunnableLock (runnable));
 }
 
+/**
+ * Causes the <code>run()</code> method of the runnable to
+ * be invoked by the user-interface thread at the next
+ * reasonable opportunity, ahead of or behind the messages
+ * posted through {@link #asyncExec(Runnable)} depending on
+ * the given priority. Messages with the same priority run
+ * in the order they were posted.
+ * <p>
+ * Note that unlike {@link #asyncExec(Runnable)}, this method
+ * is not routed through subclasses that override it.
+ * </p>
+ *
+ * @param runnable code to run on the user-interface thread.
+ * @param priority one of {@link #PRIORITY_HIGH}, {@link #PRIORITY_NORMAL}
+ *    or {@link #PRIORITY_LOW}
+ *
+ * @exception IllegalArgumentException <ul>
+ *    <li>ERROR_NULL_ARGUMENT - if the runnable is null</li>
+ * </ul>
+ * @exception SWTException <ul>
+ *    <li>ERROR_DEVICE_DISPOSED - if the display has been disposed</li>
+ * </ul>
+ *
+ * @see #asyncExec(Runnable)
+ * @since 3.122
+ */
+public void asyncExec (Runnable runnable, int priority) {
+	if (runnable == null) SWT.error (SWT.ERROR_NULL_ARGUMENT);
+	postAsyncMessage (getQueue (priority), new RunnableLock (runnable));
+}
+
+/**
+ * Causes the <code>run()</code> method of the runnable to
+ * be invoked by the user-interface thread at the next
+ * reasonable opportunity, replacing the runnable of a message
+ * that was posted with an equal key and has not run yet.
+ * Only the latest runnable for a key is run, at the queue
+ * position of the first pending one. This is useful for
+ * refresh requests where only the latest state matters.
+ *
+ * @param key the key identifying messages that may be coalesced
+ * @param runnable code to run on the user-interface thread.
+ * @param priority one of {@link #PRIORITY_HIGH}, {@link #PRIORITY_NORMAL}
+ *    or {@link #PRIORITY_LOW}
+ *
+ * @exception IllegalArgumentException <ul>
+ *    <li>ERROR_NULL_ARGUMENT - if the key or the runnable is null</li>
+ * </ul>
+ * @exception SWTException <ul>
+ *    <li>ERROR_DEVICE_DISPOSED - if the display has been disposed</li>
+ * </ul>
+ *
+ * @see #asyncExec(Runnable, int)
+ * @since 3.122
+ */
+public void asyncExecCoalesced (Object key, Runnable runnable, int priority) {
+	if (key == null || runnable == null) SWT.error (SWT.ERROR_NULL_ARGUMENT);
+	if (released || display == null) SWT.error (SWT.ERROR_DEVICE_DISPOSED);
+	RunnableLock [] added = new RunnableLock [1];
+	coalescedMessages.compute (key, (k, pending) -> {
+		if (pending != null) {
+			pending.runnable = runnable;
+			return pending;
+		}
+		RunnableLock lock = new RunnableLock (runnable);
+		lock.key = k;
+		return added [0] = lock;
+	});
+	/* Only a new message is queued, and never while the map entry is locked */
+	if (added [0] == null) return;
+	try {
+		postAsyncMessage (getQueue (priority), added [0]);
+	} catch (SWTException e) {
+		coalescedMessages.remove (key, added [0]);
+		throw e;
+	}
+}
+
+/**
+ * Sets the maximum time a single call that runs pending messages
+ * may spend before returning to the event loop. When the budget is
+ * zero, which is the default, one message is run per call.
+ * <p>
+ * A budget lets floods of <code>asyncExec()</code> calls be processed
+ * in batches while still giving input and paint events a chance to run
+ * between batches.
+ * </p>
+ *
+ * @param milliseconds the time budget per batch, or zero to run
+ *    a single message per call
+ *
+ * @since 3.122
+ */
+public void setTimeBudget (int milliseconds) {
+	budgetNanos = Math.max (0, milliseconds) * 1000000L;
+}
+
+/**
+ * Returns the number of messages that are currently waiting to be run.
+ *
+ * @return the number of pending messages
+ *
+ * @since 3.122
+ */
+public int getQueueDepth () {
+	return Math.max (0, queueDepth.get ());
+}
+
+/*
+ * Returns the maximum queue depth, the number of messages run, the total
+ * time messages waited in the queue and the maximum time a message waited
+ * in the queue, both in nanoseconds, since creation or the last reset.
+ */
+long [] getStatistics () {
+	return new long [] {maxQueueDepth, runCount, totalWaitNanos, maxWaitNanos};
+}
+
+void resetStatistics () {
+	maxQueueDepth = getQueueDepth ();
+	runCount = totalWaitNanos = maxWaitNanos = 0;
+}
+
+ConcurrentLinkedQueue<RunnableLock> getQueue (int priority) {
+	if (priority > PRIORITY_NORMAL) return highMessages;
+	if (priority < PRIORITY_NORMAL) return lowMessages;
+	return messages;
+}
+
 boolean isMessagesEmpty() {
-	return messages.isEmpty();
+	return messages.isEmpty() && highMessages.isEmpty() && lowMessages.isEmpty();
 }
 
 void releaseSynchronizer () {
+	/*
+	* Mark the receiver released before draining, so that a thread that
+	* enqueued concurrently either sees the flag and withdraws its message,
+	* or has its message drained and aborted here.
+	*/
+	released = true;
 	display = null;
-	messages.clear();
+	RunnableLock lock;
+	while ((lock = removeFirst ()) != null) {
+		lock.finish ();
+	}
+	coalescedMessages.clear ();
 	syncThread = null;
 }
 
 RunnableLock removeFirst () {
-	return messages.poll();
+	RunnableLock lock = highMessages.poll ();
+	if (lock == null) lock = messages.poll ();
+	if (lock == null) lock = lowMessages.poll ();
+	if (lock == null) return null;
+	queueDepth.decrementAndGet ();
+	/* Later messages with the same key must be queued again */
+	if (lock.key != null) coalescedMessages.remove (lock.key, lock);
+	return lock;
 }
 
 boolean runAsyncMessages () {
@@ -121,28 +340,36 @@ boolean runAsyncMessages () {
 
 boolean runAsyncMessages (boolean all) {
 	boolean run = false;
-	do {
+	long budget = budgetNanos;
+	long start = budget > 0 ? System.nanoTime () : 0;
+	while (true) {
 		RunnableLock lock = removeFirst ();
 		if (lock == null) return run;
 		run = true;
-		synchronized (lock) {
-			syncThread = lock.thread;
-			display.sendPreEvent(SWT.None);
-			try {
-				lock.run (display);
-			} catch (Throwable t) {
-				lock.throwable = t;
-				SWT.error (SWT.ERROR_FAILED_EXEC, t);
-			} finally {
-				if (display != null && !display.isDisposed()) {
-					display.sendPostEvent(SWT.None);
-				}
-				syncThread = null;
-				lock.notifyAll ();
+		long wait = System.nanoTime () - lock.enqueueTime;
+		runCount++;
+		totalWaitNanos += wait;
+		if (wait > maxWaitNanos) maxWaitNanos = wait;
+		syncThread = lock.thread;
+		display.sendPreEvent(SWT.None);
+		DispatchMonitor monitor = DispatchMonitor.current ();
+		long runStart = monitor != null ? monitor.begin (SWT.None) : 0;
+		try {
+			lock.run (display);
+		} catch (Throwable t) {
+			lock.throwable = t;
+			SWT.error (SWT.ERROR_FAILED_EXEC, t);
+		} finally {
+			if (monitor != null) monitor.endAsyncExec (lock.enqueueTime, runStart);
+			if (display != null && !display.isDisposed()) {
+				display.sendPostEvent(SWT.None);
 			}
+			syncThread = null;
+			lock.finish ();
 		}
-	} while (all);
-	return run;
+		if (display == null) return run;
+		if (!all && (budget == 0 || System.nanoTime () - start >= budget)) return run;
+	}
 }
 
 /**
@@ -160,23 +387,9 @@ boolean runAsyncMessages (boolean all) {
  * @see #asyncExec
  */
 protected void syncExec (Runnable runnable) {
-	RunnableLock lock = null;
-	synchronized (Device.class) {
-		if (display == null || display.isDisposed ()) SWT.error (SWT.ERROR_DEVICE_DISPOSED);
-		if (!display.isValidThread ()) {
-			if (runnable == null) {
-				display.wake ();
-				return;
-			}
-			lock = new RunnableLock (runnable);
-			/*
-			 * Only remember the syncThread for syncExec.
-			 */
-			lock.thread = Thread.currentThread();
-			addLast (lock);
-		}
-	}
-	if (lock == null) {
+	Display display = this.display;
+	if (released || display == null || display.isDisposed ()) SWT.error (SWT.ERROR_DEVICE_DISPOSED);
+	if (display.isValidThread ()) {
 		if (runnable != null) {
 			display.sendPreEvent(SWT.None);
 			try {
@@ -186,28 +399,45 @@ protected void syncExec (Runnable runnable) {
 			} catch (Error error) {
 				display.getErrorHandler ().accept (error);
 			} finally {
-				if (display != null && !display.isDisposed()) {
+				if (!display.isDisposed()) {
 					display.sendPostEvent(SWT.None);
 				}
 			}
 		}
 		return;
 	}
-	synchronized (lock) {
-		boolean interrupted = false;
-		while (!lock.done ()) {
-			try {
-				lock.wait ();
-			} catch (InterruptedException e) {
-				interrupted = true;
-			}
-		}
-		if (interrupted) {
-			Thread.currentThread().interrupt();
-		}
-		if (lock.throwable != null) {
-			SWT.error (SWT.ERROR_FAILED_EXEC, lock.throwable);
-		}
+	if (runnable == null) {
+		display.wake ();
+		return;
+	}
+	RunnableLock lock = new RunnableLock (runnable);
+	/*
+	 * Only remember the syncThread for syncExec.
+	 */
+	lock.thread = Thread.currentThread();
+	addLast (lock);
+	/*
+	 * The display may have been released between the check above and
+	 * the enqueue. If the message can still be withdrawn, nobody will
+	 * run it. Otherwise it is being run or aborted and will complete.
+	 */
+	if (released && messages.remove (lock)) {
+		queueDepth.decrementAndGet ();
+		SWT.error (SWT.ERROR_DEVICE_DISPOSED);
+	}
+	boolean interrupted = false;
+	while (!lock.finished) {
+		LockSupport.park (lock);
+		if (Thread.interrupted ()) interrupted = true;
+	}
+	if (interrupted) {
+		Thread.currentThread().interrupt();
+	}
+	if (lock.throwable != null) {
+		SWT.error (SWT.ERROR_FAILED_EXEC, lock.throwable);
+	}
+	if (!lock.done ()) {
+		SWT.error (SWT.ERROR_DEVICE_DISPOSED);
 	}
 }
 
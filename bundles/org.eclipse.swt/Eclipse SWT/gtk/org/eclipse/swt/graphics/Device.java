@@ -15,6 +15,7 @@ package org.eclipse.swt.graphics;
 
 
 import java.io.*;
+import java.util.Map;
 import java.util.function.*;
 import java.util.stream.*;
 
@@ -63,9 +64,7 @@ public abstract class Device implements Drawable {
 	public static boolean DEBUG;
 	boolean debug = DEBUG;
 	boolean tracking = DEBUG;
-	Error [] errors;
-	Object [] objects;
-	Object trackingLock;
+	AllocationTracker tracker;
 
 	/* Disposed flag */
 	volatile boolean disposed;
@@ -202,17 +201,11 @@ public void setTracking(boolean tracking) {
 }
 
 private void startTracking() {
-	errors = new Error [128];
-	objects = new Object [128];
-	trackingLock = new Object ();
+	tracker = new AllocationTracker ();
 }
 
 private void stopTracking() {
-	synchronized (trackingLock) {
-		objects = null;
-		errors = null;
-		trackingLock = null;
-	}
+	tracker = null;
 }
 
 /**
@@ -291,15 +284,8 @@ public void dispose () {
 }
 
 void dispose_Object (Object object) {
-	synchronized (trackingLock) {
-		for (int i=0; i<objects.length; i++) {
-			if (objects [i] == object) {
-				objects [i] = null;
-				errors [i] = null;
-				return;
-			}
-		}
-	}
+	AllocationTracker tracker = this.tracker;
+	if (tracker != null) tracker.remove (object);
 }
 
 static synchronized Device findDevice (long xDisplay) {
@@ -371,26 +357,23 @@ public DeviceData getDeviceData () {
 	DeviceData data = new DeviceData ();
 	data.debug = debug;
 	data.tracking = tracking;
-	if (tracking) {
-		synchronized (trackingLock) {
-			int count = 0, length = objects.length;
-			for (int i=0; i<length; i++) {
-				if (objects [i] != null) count++;
-			}
-			int index = 0;
-			data.objects = new Object [count];
-			data.errors = new Error [count];
-			for (int i=0; i<length; i++) {
-				if (objects [i] != null) {
-					data.objects [index] = objects [i];
-					data.errors [index] = errors [i];
-					index++;
-				}
-			}
+	AllocationTracker tracker = this.tracker;
+	if (tracking && tracker != null) {
+		Error [][] stacks = new Error [1][];
+		String [][] objectSites = new String [1][];
+		data.objects = tracker.getObjects (stacks, objectSites);
+		data.errors = stacks [0];
+		data.objectSites = objectSites [0];
+		Map<String, Integer> sites = tracker.getAllocationSites ();
+		data.allocationSites = sites.keySet ().toArray (new String [sites.size ()]);
+		data.allocationCounts = new int [data.allocationSites.length];
+		for (int i=0; i<data.allocationSites.length; i++) {
+			data.allocationCounts [i] = sites.get (data.allocationSites [i]);
 		}
 	} else {
 		data.objects = new Object [0];
 		data.errors = new Error [0];
+		data.objectSites = new String [0];
 	}
 	return data;
 }
@@ -911,23 +894,8 @@ long logProc (long log_domain, long log_level, long message, long user_data) {
 }
 
 void new_Object (Object object) {
-	synchronized (trackingLock) {
-		for (int i=0; i<objects.length; i++) {
-			if (objects [i] == null) {
-				objects [i] = object;
-				errors [i] = new Error ();
-				return;
-			}
-		}
-		Object [] newObjects = new Object [objects.length + 128];
-		System.arraycopy (objects, 0, newObjects, 0, objects.length);
-		newObjects [objects.length] = object;
-		objects = newObjects;
-		Error [] newErrors = new Error [errors.length + 128];
-		System.arraycopy (errors, 0, newErrors, 0, errors.length);
-		newErrors [errors.length] = new Error ();
-		errors = newErrors;
-	}
+	AllocationTracker tracker = this.tracker;
+	if (tracker != null) tracker.add (object);
 }
 
 static synchronized void register (Device device) {
@@ -1,5 +1,5 @@
 /*******************************************************************************
- * Copyright (c) 2000, 2010 IBM Corporation and others.
+ * Copyright (c) 2000, 2026 IBM Corporation and others.
  *
  * This program and the accompanying materials
  * are made available under the terms of the Eclipse Public License 2.0
@@ -62,4 +62,30 @@ public class DeviceData {
 	public boolean tracking;
 	public Error [] errors;
 	public Object [] objects;
+
+	/**
+	 * The allocation sites of the tracked objects, that is the first
+	 * caller outside of the SWT graphics code, and the number of
+	 * sampled objects allocated at each site that are still alive.
+	 * Only filled in by <code>Device.getDeviceData()</code> when
+	 * tracking is enabled.
+	 *
+	 * @since 3.122
+	 */
+	public String [] allocationSites;
+
+	/**
+	 * @see #allocationSites
+	 * @since 3.122
+	 */
+	public int [] allocationCounts;
+
+	/**
+	 * The allocation site of each of the tracked <code>objects</code>,
+	 * or <code>null</code> for objects whose allocation was not sampled.
+	 *
+	 * @see #allocationSites
+	 * @since 3.122
+	 */
+	public String [] objectSites;
 }
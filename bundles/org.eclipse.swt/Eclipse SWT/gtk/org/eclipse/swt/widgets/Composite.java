@@ -1,5 +1,5 @@
 /*******************************************************************************
- * Copyright (c) 2000, 2020 IBM Corporation and others.
+ * Copyright (c) 2000, 2026 IBM Corporation and others.
  *
  * This program and the accompanying materials
  * are made available under the terms of the Eclipse Public License 2.0
@@ -90,6 +90,7 @@ public class Composite extends Scrollable {
 	Map<Control, long []> fixClipMap = new HashMap<> ();
 
 	static final String NO_INPUT_METHOD = "org.eclipse.swt.internal.gtk.noInputMethod"; //$NON-NLS-1$
+	static final String PACK_SAMPLE_SIZE_KEY = "org.eclipse.swt.internal.gtk.packSampleSize"; //$NON-NLS-1$
 	Shell popupChild;
 	/**
 	 * If set to {@code true}, child widgets with negative y coordinate GTK allocation
@@ -786,6 +787,47 @@ int getChildrenCount () {
 	return count;
 }
 
+/*
+ * Returns the number of rows a Table or Tree column measures when it is
+ * packed, or 0 to measure all of them.
+ */
+int getPackSampleSize () {
+	Object value = getData (PACK_SAMPLE_SIZE_KEY);
+	return Math.max (0, value instanceof Integer ? ((Integer) value).intValue () : Integer.getInteger (PACK_SAMPLE_SIZE_KEY, 0));
+}
+
+/*
+ * Selects the rows measured when a column with more rows than the sample
+ * size is packed. Half of the sample is spread evenly over the rows, the
+ * other half are the rows with the longest texts.
+ */
+static boolean [] selectPackSample (int [] lengths, int count, int sampleSize) {
+	boolean [] selected = new boolean [count];
+	int spread = sampleSize / 2, longest = sampleSize - spread;
+	if (spread > 0) {
+		int stride = Math.max (1, count / spread);
+		for (int i=0; i<count; i+=stride) selected [i] = true;
+	}
+	if (longest > 0 && count > 0) {
+		int [] sorted = Arrays.copyOf (lengths, count);
+		Arrays.sort (sorted);
+		int threshold = sorted [Math.max (0, count - longest)];
+		for (int i=0; i<count && longest>0; i++) {
+			if (lengths [i] > threshold && !selected [i]) {
+				selected [i] = true;
+				longest--;
+			}
+		}
+		for (int i=0; i<count && longest>0; i++) {
+			if (lengths [i] == threshold && !selected [i]) {
+				selected [i] = true;
+				longest--;
+			}
+		}
+	}
+	return selected;
+}
+
 @Override
 Rectangle getClientAreaInPixels () {
 	checkWidget();
@@ -1,5 +1,5 @@
 /*******************************************************************************
- * Copyright (c) 2000, 2018 IBM Corporation and others.
+ * Copyright (c) 2000, 2026 IBM Corporation and others.
  *
  * This program and the accompanying materials
  * are made available under the terms of the Eclipse Public License 2.0
@@ -95,6 +95,9 @@ public abstract class Control extends Widget implements Drawable {
 
 	LinkedList <Event> dragDetectionQueue;
 
+	/* The pending redraws of the control, queued in its shell until the next frame */
+	Shell.Damage damage, childDamage;
+
 	static Callback gestureZoom, gestureRotation, gestureSwipe, gestureBegin, gestureEnd;
 	static {
 		gestureZoom = new Callback (Control.class, "magnifyProc", void.class, new Type[] {
@@ -4714,6 +4717,10 @@ void redrawChildren () {
 
 void redrawWidget (int x, int y, int width, int height, boolean redrawAll, boolean all, boolean trim) {
 	if (!GTK.gtk_widget_get_realized(handle)) return;
+	if (!GTK.GTK4 && display.redrawCoalescing) {
+		display.addDamage (getShell (), this, x, y, width, height, redrawAll, all);
+		return;
+	}
 	GdkRectangle rect = new GdkRectangle ();
 	if (GTK.GTK4) {
 		long surface = paintSurface ();
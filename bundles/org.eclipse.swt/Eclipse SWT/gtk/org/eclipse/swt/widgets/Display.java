@@ -1,5 +1,5 @@
 /*******************************************************************************
- * Copyright (c) 2000, 2022 IBM Corporation and others.
+ * Copyright (c) 2000, 2026 IBM Corporation and others.
  *
  * This program and the accompanying materials
  * are made available under the terms of the Eclipse Public License 2.0
@@ -155,13 +155,23 @@ public class Display extends Device implements Executor {
 	long shellMapProcClosure;
 	boolean externalEventLoop; // events are dispatched outside SWT, e.g. when system dialog is open
 
-	/* Widget Table */
+	/*
+	* Widget Table. Each handle stores its slot index plus one as
+	* SWT_OBJECT_INDEX qdata, so a lookup is one qdata read. The free slots
+	* of the lower and the upper half of the table are chained separately
+	* and the lower half is used first. Entries never move, so the qdata
+	* stays valid: the table doubles when it is full and halves once its
+	* upper half is free and less than an eighth of it is in use.
+	*/
 	int [] indexTable;
-	int freeSlot;
+	int freeSlot, freeHighSlot, highCount;
+	long [] handleTable;
+	Widget [] widgetTable;
+	int widgetCount, widgetTableGrows, widgetTableShrinks;
 	long lastHandle;
 	Widget lastWidget;
-	Widget [] widgetTable;
 	final static int GROW_SIZE = 1024;
+	static final String WIDGET_TABLE_STATISTICS_KEY = "org.eclipse.swt.internal.gtk.widgetTableStatistics"; //$NON-NLS-1$
 	static final int SWT_OBJECT_INDEX;
 	static final int SWT_OBJECT_INDEX1;
 	static final int SWT_OBJECT_INDEX2;
@@ -220,6 +230,32 @@ public class Display extends Device implements Executor {
 		}
 	}
 
+	/*
+	* Timers whose deadlines fall into the same coalescing interval share
+	* a single GLib source. The group is detached from timerGroupMap when
+	* it fires, so slots are checked against timerGroups before running.
+	*/
+	static final class TimerGroup {
+		long tick;
+		int sourceId;
+		int live, slotCount;
+		int [] slots = new int [4];
+
+		TimerGroup (long tick) {
+			this.tick = tick;
+		}
+
+		void add (int slot) {
+			if (slotCount == slots.length) {
+				int [] newSlots = new int [slots.length * 2];
+				System.arraycopy (slots, 0, newSlots, 0, slotCount);
+				slots = newSlots;
+			}
+			slots [slotCount++] = slot;
+			live++;
+		}
+	}
+
 	SessionManagerDBus sessionManagerDBus;
 	SessionManagerListener sessionManagerListener;
 	Runnable [] disposeList;
@@ -235,8 +271,21 @@ public class Display extends Device implements Executor {
 	/* Timers */
 	int [] timerIds;
 	Runnable [] timerList;
+	TimerGroup [] timerGroups;
+	int [] timerFreeSlots;
+	int timerFreeCount, timerSlotCount;
+	Map<Runnable, Integer> timerSlots;
+	Map<Long, TimerGroup> timerGroupMap;
+	long timerEpoch;
+	int timerCoalescing = Integer.getInteger (TIMER_COALESCING_KEY, 0);
+	static final String TIMER_COALESCING_KEY = "org.eclipse.swt.internal.gtk.timerCoalescing"; //$NON-NLS-1$
 	Callback timerCallback;
 	long timerProc;
+
+	/* Dispatch monitoring */
+	DispatchMonitor dispatchMonitor;
+	static final String DISPATCH_MONITOR_KEY = "org.eclipse.swt.internal.gtk.dispatchMonitor"; //$NON-NLS-1$
+	static final String STALL_THRESHOLD_PROPERTY = "org.eclipse.swt.internal.dispatchMonitor.stallThreshold"; //$NON-NLS-1$
 	Callback windowTimerCallback;
 	long windowTimerProc;
 
@@ -273,6 +322,17 @@ public class Display extends Device implements Executor {
 	Object idleLock = new Object();
 	boolean idleNeeded;
 
+	/* Redraw coalescing, off unless enabled with the data key or system property */
+	Shell [] damagedShells;
+	int damagedShellCount, damageHandle;
+	long damageProc;
+	Callback damageCallback;
+	boolean redrawCoalescing = Boolean.getBoolean (REDRAW_COALESCING_KEY);
+	long [] redrawStatistics = new long [4];
+	static final String REDRAW_COALESCING_KEY = "org.eclipse.swt.internal.gtk.redrawCoalescing"; //$NON-NLS-1$
+	static final String REDRAW_STATISTICS_KEY = "org.eclipse.swt.internal.gtk.redrawStatistics"; //$NON-NLS-1$
+	static final int REDRAW_REQUESTED = 0, REDRAW_COALESCED = 1, REDRAW_REGIONS = 2, REDRAW_FRAMES = 3;
+
 	/* GtkTreeView callbacks */
 	long cellDataProc;
 	Callback cellDataCallback;
@@ -848,6 +908,29 @@ void addPopup (Menu menu) {
 	popups [index] = menu;
 }
 
+/*
+* Accumulates an invalidated area of a control in its shell instead of
+* invalidating it right away. The damage of all shells is flushed from a
+* main loop source that runs ahead of the frame clock, so that the areas
+* invalidated while handling an update are painted in a single frame.
+*/
+void addDamage (Shell shell, Control control, int x, int y, int width, int height, boolean redrawAll, boolean all) {
+	redrawStatistics [REDRAW_REQUESTED]++;
+	if (shell.damageCount == 0) {
+		if (damagedShells == null) damagedShells = new Shell [4];
+		if (damagedShellCount == damagedShells.length) {
+			Shell [] newShells = new Shell [damagedShellCount * 2];
+			System.arraycopy (damagedShells, 0, newShells, 0, damagedShellCount);
+			damagedShells = newShells;
+		}
+		damagedShells [damagedShellCount++] = shell;
+	}
+	if (!shell.addDamage (control, x, y, width, height, redrawAll, all)) {
+		redrawStatistics [REDRAW_COALESCED]++;
+	}
+	if (damageHandle == 0) damageHandle = OS.g_timeout_add (0, damageProc, 0);
+}
+
 void addSkinnableWidget (Widget widget) {
 	if (skinCount >= skinList.length) {
 		Widget[] newSkinWidgets = new Widget [(skinList.length + 1) * 3 / 2];
@@ -859,37 +942,31 @@ void addSkinnableWidget (Widget widget) {
 
 void addWidget (long handle, Widget widget) {
 	if (handle == 0) return;
-	// Last element in the indexTable is -1, so if freeSlot == -1 we have no place anymore
-	if (freeSlot == LAST_TABLE_INDEX) {
-		int length = (freeSlot = indexTable.length) + GROW_SIZE;
-		int[] newIndexTable = new int[length];
-		Widget[] newWidgetTable = new Widget [length];
-		System.arraycopy (indexTable, 0, newIndexTable, 0, freeSlot);
-		System.arraycopy (widgetTable, 0, newWidgetTable, 0, freeSlot);
-		for (int i = freeSlot; i < length - 1; i++) {
-			newIndexTable[i] = i + 1;
-		}
-		// mark last slot as "need resize"
-		newIndexTable[length - 1] = LAST_TABLE_INDEX;
-		indexTable = newIndexTable;
-		widgetTable = newWidgetTable;
-	}
-	int index = freeSlot + 1;
+	if (freeSlot == LAST_TABLE_INDEX && freeHighSlot == LAST_TABLE_INDEX) growWidgetTable ();
+	boolean high = freeSlot == LAST_TABLE_INDEX;
+	int slot = high ? freeHighSlot : freeSlot;
+	int index = slot + 1;
 	if(strictChecks) {
 		long data = OS.g_object_get_qdata (handle, SWT_OBJECT_INDEX);
 		if(data > 0 && data != index) {
 			SWT.error(SWT.ERROR_INVALID_ARGUMENT, null, ". Potential leak of " + widget + debugInfoForIndex(data - 1));
 		}
 	}
+	if(widgetTable [slot] != null) {
+		SWT.error(SWT.ERROR_INVALID_ARGUMENT, null, ". Trying to override non empty slot with " + widget + debugInfoForIndex(slot));
+	}
 	OS.g_object_set_qdata (handle, SWT_OBJECT_INDEX, index);
-	int oldSlot = freeSlot;
-	freeSlot = indexTable[oldSlot];
-	// Mark old index slot as used
-	indexTable [oldSlot] = SLOT_IN_USE;
-	if(widgetTable [oldSlot] != null) {
-		SWT.error(SWT.ERROR_INVALID_ARGUMENT, null, ". Trying to override non empty slot with " + widget + debugInfoForIndex(oldSlot));
+	if (high) {
+		freeHighSlot = indexTable [slot];
+		highCount++;
+	} else {
+		freeSlot = indexTable [slot];
 	}
-	widgetTable [oldSlot] = widget;
+	// Mark the slot as used
+	indexTable [slot] = SLOT_IN_USE;
+	handleTable [slot] = handle;
+	widgetTable [slot] = widget;
+	widgetCount++;
 }
 
 /**
@@ -931,6 +1008,27 @@ public void asyncExec (Runnable runnable) {
 	}
 }
 
+/*
+ * Runs post, which queues a message of the synchronizer posted with a
+ * priority or a key, the same way asyncExec(Runnable) queues messages.
+ * This makes sure the idle handler runs them in nested native loops too.
+ */
+void postAsyncMessage (Runnable post) {
+	synchronized (Device.class) {
+		if (isDisposed ()) error (SWT.ERROR_DEVICE_DISPOSED);
+		synchronized (idleLock) {
+			if (idleNeeded && idleHandle == 0) {
+				if (GTK.GTK4) {
+					idleHandle = OS.g_idle_add (idleProc, 0);
+				} else {
+					idleHandle = GDK.gdk_threads_add_idle (idleProc, 0);
+				}
+			}
+		}
+		post.run ();
+	}
+}
+
 /**
  * Executes the given runnable in the user-interface thread of this Display.
  * <ul>
@@ -1594,7 +1692,15 @@ long eventProc (long event, long data) {
 	if (tracker != null) {
 		dispatch = tracker.processEvent (event);
 	}
-	if (dispatch) GTK3.gtk_main_do_event (event);
+	if (dispatch) {
+		DispatchMonitor monitor = dispatchMonitor;
+		long start = monitor != null ? monitor.begin (eventType) : 0;
+		try {
+			GTK3.gtk_main_do_event (event);
+		} finally {
+			if (monitor != null) monitor.endNativeEvent (eventType, start);
+		}
+	}
 	if (dispatchEvents == null) putGdkEvents ();
 	return 0;
 }
@@ -1724,6 +1830,7 @@ static long rendererSnapshotProc (long cell, long snapshot, long handle, long ba
 }
 
 void flushExposes (long window, boolean all) {
+	flushDamage ();
 	if (OS.isX11()) {
 		this.flushWindow = window;
 		this.flushAll = all;
@@ -2073,6 +2180,21 @@ public Object getData (String key) {
 	if (key.equals (GET_EMISSION_PROC_KEY)) {
 		return new LONG (emissionProc);
 	}
+	if (key.equals (TIMER_COALESCING_KEY)) {
+		return timerCoalescing;
+	}
+	if (key.equals (DISPATCH_MONITOR_KEY)) {
+		return dispatchMonitor;
+	}
+	if (key.equals (WIDGET_TABLE_STATISTICS_KEY)) {
+		return getWidgetTableStatistics ();
+	}
+	if (key.equals (REDRAW_COALESCING_KEY)) {
+		return redrawCoalescing;
+	}
+	if (key.equals (REDRAW_STATISTICS_KEY)) {
+		return redrawStatistics.clone ();
+	}
 	if (keys == null) return null;
 	for (int i=0; i<keys.length; i++) {
 		if (keys [i].equals (key)) return values [i];
@@ -2757,8 +2879,9 @@ public Monitor getPrimaryMonitor() {
  */
 public Shell [] getShells () {
 	checkDevice ();
-	int index = 0;
+	int index = 0, disposedCount = 0;
 	Shell [] result = new Shell [16];
+	int [] disposedSlots = null;
 	for (int i = 0; i < widgetTable.length; i++) {
 		Widget widget = widgetTable [i];
 		if (!(widget instanceof Shell)) {
@@ -2786,16 +2909,24 @@ public Shell [] getShells () {
 			// we at least try to report an error (we have no logging context).
 			System.err.println ("SWT ERROR: disposed shell detected in the table" + debugInfoForIndex(i));
 
-			// As of today widgetTable contains *four* entries for the *same*
-			// Shell instance. If we found one broken, there can be others...
-			// So we clean here all the occurencies of the leaked shell.
-			for (int j = i; j < widgetTable.length; j++) {
-				if(widgetTable[j] == widget) {
-					widgetTable[j] = null;
-				}
+			// The table contains several entries for the same Shell instance,
+			// one per handle, and all of them are found by this loop. Their
+			// slots are freed afterwards, without touching the handles, which
+			// may already have been freed.
+			if (disposedSlots == null) disposedSlots = new int [4];
+			if (disposedCount == disposedSlots.length) {
+				int [] newSlots = new int [disposedCount * 2];
+				System.arraycopy (disposedSlots, 0, newSlots, 0, disposedCount);
+				disposedSlots = newSlots;
 			}
+			disposedSlots [disposedCount++] = i;
 		}
 	}
+	for (int i = 0; i < disposedCount; i++) {
+		if (lastHandle == handleTable [disposedSlots [i]]) lastWidget = null;
+		removeWidgetAt (disposedSlots [i]);
+	}
+	if (disposedCount > 0) shrinkWidgetTable ();
 	if (index == result.length) return result;
 	Shell [] newResult = new Shell [index];
 	System.arraycopy (result, 0, newResult, 0, index);
@@ -3444,13 +3575,32 @@ Widget getWidget (long handle) {
 	if (handle == 0) return null;
 	if (lastWidget != null && lastHandle == handle) return lastWidget;
 	long index = OS.g_object_get_qdata (handle, SWT_OBJECT_INDEX) - 1;
-	if (0 <= index && index < widgetTable.length) {
+	if (0 <= index && index < widgetTable.length && handleTable [(int)index] == handle) {
 		lastHandle = handle;
 		return lastWidget = widgetTable [(int)index];
 	}
 	return null;
 }
 
+long damageProc (long data) {
+	damageHandle = 0;
+	flushDamage ();
+	return 0;
+}
+
+void flushDamage () {
+	if (damagedShellCount == 0) return;
+	if (damageHandle != 0) OS.g_source_remove (damageHandle);
+	damageHandle = 0;
+	for (int i = 0; i < damagedShellCount; i++) {
+		Shell shell = damagedShells [i];
+		damagedShells [i] = null;
+		if (!shell.isDisposed ()) redrawStatistics [REDRAW_REGIONS] += shell.flushDamage ();
+	}
+	damagedShellCount = 0;
+	redrawStatistics [REDRAW_FRAMES]++;
+}
+
 long idleProc (long data) {
 	boolean result = runAsyncMessages (false);
 	if (!result) {
@@ -3479,6 +3629,8 @@ protected void init () {
 	initializeSystemSettings ();
 	initializeWidgetTable ();
 	initializeSessionManager ();
+	Integer stallThreshold = Integer.getInteger (STALL_THRESHOLD_PROPERTY);
+	if (stallThreshold != null) setDispatchMonitor (new DispatchMonitor (thread, stallThreshold));
 }
 
 void initializeCallbacks () {
@@ -3740,6 +3892,9 @@ void initializeCallbacks () {
 
 	idleCallback = new Callback (this, "idleProc", 1); //$NON-NLS-1$
 	idleProc = idleCallback.getAddress ();
+
+	damageCallback = new Callback (this, "damageProc", 1); //$NON-NLS-1$
+	damageProc = damageCallback.getAddress ();
 }
 
 void initializeNamedColorList() {
@@ -3812,9 +3967,10 @@ void initializeSystemSettings () {
 
 void initializeWidgetTable () {
 	indexTable = new int [GROW_SIZE];
+	handleTable = new long [GROW_SIZE];
 	widgetTable = new Widget [GROW_SIZE];
-	for (int i=0; i<GROW_SIZE-1; i++) indexTable [i] = i + 1;
-	indexTable [GROW_SIZE - 1] = -1;
+	widgetCount = 0;
+	linkWidgetSlots ();
 }
 
 void initializeSessionManager() {
@@ -4613,6 +4769,7 @@ protected void release () {
 }
 
 void releaseDisplay () {
+	setDispatchMonitor (null);
 	windowCallback2.dispose ();  windowCallback2 = null;
 	windowCallback3.dispose ();  windowCallback3 = null;
 	windowCallback4.dispose ();  windowCallback4 = null;
@@ -4699,10 +4856,21 @@ void releaseDisplay () {
 	shellMapProc = 0;
 
 	/* Dispose the run async messages callback */
+	synchronized (idleLock) {
+		idleNeeded = false;
+		if (idleHandle != 0) OS.g_source_remove (idleHandle);
+		idleHandle = 0;
+	}
 	idleCallback.dispose (); idleCallback = null;
 	idleProc = 0;
-	if (idleHandle != 0) OS.g_source_remove (idleHandle);
-	idleHandle = 0;
+
+	/* Dispose the redraw coalescing callback */
+	if (damageHandle != 0) OS.g_source_remove (damageHandle);
+	damageHandle = 0;
+	damagedShells = null;
+	damagedShellCount = 0;
+	damageCallback.dispose (); damageCallback = null;
+	damageProc = 0;
 
 	/* Dispose GtkTreeView callbacks */
 	cellDataCallback.dispose (); cellDataCallback = null;
@@ -4735,12 +4903,22 @@ void releaseDisplay () {
 
 	/* Dispose the timer callback */
 	if (timerIds != null) {
-		for (int i=0; i<timerIds.length; i++) {
+		for (int i=0; i<timerSlotCount; i++) {
 			if (timerIds [i] != 0) OS.g_source_remove (timerIds [i]);
 		}
 	}
+	if (timerGroupMap != null) {
+		for (TimerGroup group : timerGroupMap.values ()) {
+			if (group.sourceId != 0) OS.g_source_remove (group.sourceId);
+		}
+	}
 	timerIds = null;
 	timerList = null;
+	timerGroups = null;
+	timerFreeSlots = null;
+	timerFreeCount = timerSlotCount = 0;
+	timerSlots = null;
+	timerGroupMap = null;
 	timerProc = 0;
 	timerCallback.dispose ();
 	timerCallback = null;
@@ -4842,6 +5020,7 @@ void releaseDisplay () {
 	lastWidget = activeShell = null;
 	flushData = closures = null;
 	indexTable = signalIds = null;
+	handleTable = null;
 	widgetTable = modalShells = null;
 	data = null;
 	values = keys = null;
@@ -4975,27 +5154,97 @@ void removePopup (Menu menu) {
 Widget removeWidget (long handle) {
 	if (handle == 0) return null;
 	lastWidget = null;
-	Widget widget = null;
-	int index;
 	long data = OS.g_object_get_qdata (handle, SWT_OBJECT_INDEX) - 1;
 	if(data < 0 || data > Integer.MAX_VALUE) {
 		SWT.error(SWT.ERROR_INVALID_RETURN_VALUE, null, ". g_object_get_qdata returned unexpected index value" +  debugInfoForIndex(data));
 	}
-	index = (int)data;
-	if (0 <= index && index < widgetTable.length) {
-		widget = widgetTable [index];
-		widgetTable [index] = null;
+	int index = (int)data;
+	if (index >= widgetTable.length) {
+		SWT.error(SWT.ERROR_INVALID_ARGUMENT, null, ". Invalid index for handle " + handle + debugInfoForIndex(index));
+	}
+	if (handleTable [index] != handle) {
+		SWT.error(SWT.ERROR_INVALID_ARGUMENT, null, ". Widget already released" + debugInfoForIndex(index));
+	}
+	OS.g_object_set_qdata (handle, SWT_OBJECT_INDEX, 0);
+	Widget widget = removeWidgetAt (index);
+	shrinkWidgetTable ();
+	return widget;
+}
+
+/*
+* Frees a slot without touching its handle, which may already have been
+* freed.
+*/
+Widget removeWidgetAt (int index) {
+	Widget widget = widgetTable [index];
+	widgetTable [index] = null;
+	handleTable [index] = 0;
+	if (index >= indexTable.length / 2) {
+		indexTable [index] = freeHighSlot;
+		freeHighSlot = index;
+		highCount--;
+	} else {
 		indexTable [index] = freeSlot;
 		freeSlot = index;
-		OS.g_object_set_qdata (handle, SWT_OBJECT_INDEX, 0);
+	}
+	widgetCount--;
+	return widget;
+}
+
+void growWidgetTable () {
+	int oldLength = indexTable.length, length = oldLength * 2;
+	indexTable = Arrays.copyOf (indexTable, length);
+	handleTable = Arrays.copyOf (handleTable, length);
+	widgetTable = Arrays.copyOf (widgetTable, length);
+	// The full old table becomes the lower half, the new slots the upper half
+	for (int i = oldLength; i < length - 1; i++) {
+		indexTable [i] = i + 1;
+	}
+	indexTable [length - 1] = LAST_TABLE_INDEX;
+	freeSlot = LAST_TABLE_INDEX;
+	freeHighSlot = oldLength;
+	highCount = 0;
+	widgetTableGrows++;
+}
+
+void shrinkWidgetTable () {
+	int length = indexTable.length;
+	if (highCount != 0 || length <= GROW_SIZE || widgetCount * 8 >= length) return;
+	length /= 2;
+	indexTable = Arrays.copyOf (indexTable, length);
+	handleTable = Arrays.copyOf (handleTable, length);
+	widgetTable = Arrays.copyOf (widgetTable, length);
+	linkWidgetSlots ();
+	widgetTableShrinks++;
+}
 
-		if(widget == null) {
-			SWT.error(SWT.ERROR_INVALID_ARGUMENT, null, ". Widget already released" + debugInfoForIndex(index));
+/*
+* Chains the free slots of each half of the table, lowest slot first.
+*/
+void linkWidgetSlots () {
+	int half = indexTable.length / 2;
+	freeSlot = freeHighSlot = LAST_TABLE_INDEX;
+	highCount = 0;
+	for (int i = indexTable.length - 1; i >= 0; i--) {
+		if (indexTable [i] == SLOT_IN_USE) {
+			if (i >= half) highCount++;
+		} else if (i >= half) {
+			indexTable [i] = freeHighSlot;
+			freeHighSlot = i;
+		} else {
+			indexTable [i] = freeSlot;
+			freeSlot = i;
 		}
-	} else {
-		SWT.error(SWT.ERROR_INVALID_ARGUMENT, null, ". Invalid index for handle " + handle + debugInfoForIndex(index));
 	}
-	return widget;
+}
+
+/*
+* Returns the number of widget handles, the table capacity, the number of
+* handles in the upper half of the table, and how often the table grew and
+* shrank.
+*/
+int [] getWidgetTableStatistics () {
+	return new int [] {widgetCount, indexTable.length, highCount, widgetTableGrows, widgetTableShrinks};
 }
 
 String debugInfoForIndex(long index) {
@@ -5019,17 +5268,19 @@ void dpiChanged(int newScaleFactor) {
 String dumpWidgetTableInfo() {
 	StringBuilder sb = new StringBuilder(", table size: ");
 	sb.append(widgetTable.length);
-	IdentityHashMap<Widget, Collection<Integer>> disposed = new IdentityHashMap<>();
+	sb.append(", widget handles: ");
+	sb.append(widgetCount);
+	IdentityHashMap<Widget, Collection<Long>> disposed = new IdentityHashMap<>();
 	for (int i = 0; i < widgetTable.length; i++) {
 		Widget w = widgetTable[i];
 		if (w != null && w.isDisposed()) {
-			disposed.computeIfAbsent(w, k -> new ArrayList<>()).add(Integer.valueOf(i));
+			disposed.computeIfAbsent(w, k -> new ArrayList<>()).add(Long.valueOf(handleTable[i]));
 		}
 	}
 	if (!disposed.isEmpty()) {
 		sb.append(", leaked elements:");
-		Set<Entry<Widget,Collection<Integer>>> set = disposed.entrySet();
-		for (Entry<Widget, Collection<Integer>> entry : set) {
+		Set<Entry<Widget,Collection<Long>>> set = disposed.entrySet();
+		for (Entry<Widget, Collection<Long>> entry : set) {
 			sb.append(" ").append(entry.getKey()).append(" at ").append(entry.getValue()).append(",");
 		}
 	}
@@ -5338,6 +5589,25 @@ public void setData (String key, Object value) {
 		externalEventLoop = data != null && data.booleanValue ();
 		return;
 	}
+	if (key.equals (TIMER_COALESCING_KEY)) {
+		Integer data = (Integer) value;
+		timerCoalescing = data != null ? Math.max (0, data.intValue ()) : 0;
+		return;
+	}
+	if (key.equals (DISPATCH_MONITOR_KEY)) {
+		setDispatchMonitor ((DispatchMonitor) value);
+		return;
+	}
+	if (key.equals (REDRAW_COALESCING_KEY)) {
+		Boolean data = (Boolean) value;
+		flushDamage ();
+		redrawCoalescing = data != null && data.booleanValue ();
+		return;
+	}
+	if (key.equals (REDRAW_STATISTICS_KEY)) {
+		Arrays.fill (redrawStatistics, 0);
+		return;
+	}
 
 	/* Remove the key/value pair */
 	if (value == null) {
@@ -5606,6 +5876,8 @@ public boolean sleep () {
 	}
 	if (!synchronizer.isMessagesEmpty()) return true;
 	sendPreExternalEventDispatchEvent ();
+	DispatchMonitor monitor = dispatchMonitor;
+	if (monitor != null) monitor.sleep (true);
 	if (!GTK.GTK4) GDK.gdk_threads_leave ();
 	/*
 	 * The code below replicates event waiting behavior of g_main_context_iteration
@@ -5647,6 +5919,7 @@ public boolean sleep () {
 	} while (!result && synchronizer.isMessagesEmpty() && !wake);
 	wake = false;
 	if (!GTK.GTK4) GDK.gdk_threads_enter ();
+	if (monitor != null) monitor.sleep (false);
 	sendPostExternalEventDispatchEvent ();
 	return true;
 }
@@ -5679,66 +5952,133 @@ public boolean sleep () {
 public void timerExec (int milliseconds, Runnable runnable) {
 	checkDevice ();
 	if (runnable == null) error (SWT.ERROR_NULL_ARGUMENT);
-	if (timerList == null) timerList = new Runnable [4];
-	if (timerIds == null) timerIds = new int [4];
-	int index = 0;
-	while (index < timerList.length) {
-		if (timerList [index] == runnable) break;
-		index++;
-	}
-	if (index != timerList.length) {
-		OS.g_source_remove (timerIds [index]);
-		timerList [index] = null;
-		timerIds [index] = 0;
-		if (milliseconds < 0) return;
-	} else {
-		if (milliseconds < 0) return;
-		index = 0;
-		while (index < timerList.length) {
-			if (timerList [index] == null) break;
-			index++;
+	if (timerList == null) {
+		timerList = new Runnable [16];
+		timerIds = new int [16];
+		timerGroups = new TimerGroup [16];
+		timerFreeSlots = new int [16];
+		timerSlots = new IdentityHashMap<> ();
+		timerGroupMap = new HashMap<> ();
+		timerEpoch = System.nanoTime ();
+	}
+	Integer existing = timerSlots.remove (runnable);
+	if (existing != null) removeTimer (existing.intValue ());
+	if (milliseconds < 0) return;
+	int index = allocateTimerSlot ();
+	if (timerCoalescing > 0) {
+		/*
+		* Round the deadline up to the next multiple of the coalescing
+		* interval and share one GLib source per interval. The negated
+		* tick is passed to timerProc to distinguish it from a slot index.
+		*/
+		long now = (System.nanoTime () - timerEpoch) / 1000000;
+		long tick = (now + milliseconds + timerCoalescing - 1) / timerCoalescing + 1;
+		TimerGroup group = timerGroupMap.get (tick);
+		if (group == null) {
+			int delay = (int) Math.max (0, (tick - 1) * timerCoalescing - now);
+			int timerId = addTimeout (delay, -tick);
+			if (timerId == 0) {
+				releaseTimerSlot (index);
+				return;
+			}
+			group = new TimerGroup (tick);
+			group.sourceId = timerId;
+			timerGroupMap.put (tick, group);
 		}
-		if (index == timerList.length) {
-			Runnable [] newTimerList = new Runnable [timerList.length + 4];
-			System.arraycopy (timerList, 0, newTimerList, 0, timerList.length);
-			timerList = newTimerList;
-			int [] newTimerIds = new int [timerIds.length + 4];
-			System.arraycopy (timerIds, 0, newTimerIds, 0, timerIds.length);
-			timerIds = newTimerIds;
+		group.add (index);
+		timerGroups [index] = group;
+	} else {
+		int timerId = addTimeout (milliseconds, index);
+		if (timerId == 0) {
+			releaseTimerSlot (index);
+			return;
 		}
+		timerIds [index] = timerId;
 	}
-	int timerId;
+	timerList [index] = runnable;
+	timerSlots.put (runnable, index);
+}
+
+int addTimeout (int milliseconds, long data) {
 	if (GTK.GTK4) {
-		timerId = OS.g_timeout_add (milliseconds, timerProc, index);
+		return OS.g_timeout_add (milliseconds, timerProc, data);
 	} else {
-		timerId = GDK.gdk_threads_add_timeout (milliseconds, timerProc, index);
-	}
-	if (timerId != 0) {
-		timerIds [index] = timerId;
-		timerList [index] = runnable;
+		return GDK.gdk_threads_add_timeout (milliseconds, timerProc, data);
+	}
+}
+
+int allocateTimerSlot () {
+	if (timerFreeCount > 0) return timerFreeSlots [--timerFreeCount];
+	if (timerSlotCount == timerList.length) {
+		int length = timerList.length * 2;
+		Runnable [] newTimerList = new Runnable [length];
+		System.arraycopy (timerList, 0, newTimerList, 0, timerSlotCount);
+		timerList = newTimerList;
+		int [] newTimerIds = new int [length];
+		System.arraycopy (timerIds, 0, newTimerIds, 0, timerSlotCount);
+		timerIds = newTimerIds;
+		TimerGroup [] newTimerGroups = new TimerGroup [length];
+		System.arraycopy (timerGroups, 0, newTimerGroups, 0, timerSlotCount);
+		timerGroups = newTimerGroups;
+		int [] newFreeSlots = new int [length];
+		System.arraycopy (timerFreeSlots, 0, newFreeSlots, 0, timerFreeCount);
+		timerFreeSlots = newFreeSlots;
+	}
+	return timerSlotCount++;
+}
+
+void releaseTimerSlot (int index) {
+	timerList [index] = null;
+	timerIds [index] = 0;
+	timerGroups [index] = null;
+	timerFreeSlots [timerFreeCount++] = index;
+}
+
+void removeTimer (int index) {
+	TimerGroup group = timerGroups [index];
+	if (group != null) {
+		/* Only remove the shared source if the group has not fired yet */
+		if (--group.live == 0 && timerGroupMap.get (group.tick) == group) {
+			OS.g_source_remove (group.sourceId);
+			timerGroupMap.remove (group.tick);
+		}
+	} else {
+		OS.g_source_remove (timerIds [index]);
 	}
+	releaseTimerSlot (index);
 }
 
 long timerProc (long i) {
 	if (timerList == null) return 0;
-	int index = (int)i;
-	if (0 <= index && index < timerList.length) {
-		Runnable runnable = timerList [index];
-		timerList [index] = null;
-		timerIds [index] = 0;
-		if (runnable != null) {
-			try {
-				runnable.run ();
-			} catch (RuntimeException exception) {
-				runtimeExceptionHandler.accept (exception);
-			} catch (Error exception) {
-				errorHandler.accept (exception);
-			}
+	if (i < 0) {
+		TimerGroup group = timerGroupMap.get (-i);
+		if (group == null) return 0;
+		timerGroupMap.remove (-i);
+		for (int j = 0; j < group.slotCount && timerList != null; j++) {
+			int index = group.slots [j];
+			if (timerGroups [index] == group) runTimer (index);
 		}
+		return 0;
 	}
+	int index = (int)i;
+	if (0 <= index && index < timerSlotCount) runTimer (index);
 	return 0;
 }
 
+void runTimer (int index) {
+	Runnable runnable = timerList [index];
+	if (runnable == null) return;
+	timerSlots.remove (runnable);
+	releaseTimerSlot (index);
+	try {
+		runnable.run ();
+	} catch (RuntimeException exception) {
+		runtimeExceptionHandler.accept (exception);
+	} catch (Error exception) {
+		errorHandler.accept (exception);
+	}
+}
+
 long caretProc (long clientData) {
 	caretId = 0;
 	if (currentCaret == null) {
@@ -5892,6 +6232,13 @@ public void sendPostExternalEventDispatchEvent () {
 	sendJDKInternalEvent (SWT.PostExternalEventDispatch);
 }
 
+void setDispatchMonitor (DispatchMonitor monitor) {
+	if (dispatchMonitor == monitor) return;
+	if (dispatchMonitor != null) dispatchMonitor.uninstall ();
+	dispatchMonitor = monitor;
+	if (monitor != null) monitor.install ();
+}
+
 void setCurrentCaret (Caret caret) {
 	if (caretId != 0) OS.g_source_remove(caretId);
 	caretId = 0;
@@ -5943,17 +6290,20 @@ long signalProc (long gobject, long arg1, long user_data) {
  * @see #asyncExec
  */
 public void syncExec (Runnable runnable) {
-	Synchronizer synchronizer;
-	synchronized (Device.class) {
-		if (isDisposed ()) error (SWT.ERROR_DEVICE_DISPOSED);
-		synchronizer = this.synchronizer;
-		synchronized (idleLock) {
-			if (idleNeeded && idleHandle == 0) {
-				if (GTK.GTK4) {
-					idleHandle = OS.g_idle_add (idleProc, 0);
-				} else {
-					idleHandle = GDK.gdk_threads_add_idle (idleProc, 0);
-				}
+	/*
+	* Avoid the global Device.class lock here. The synchronizer validates
+	* the display state itself, and releaseDisplay() clears idleNeeded
+	* under idleLock, so no idle source can be added after release.
+	*/
+	Synchronizer synchronizer = this.synchronizer;
+	Object idleLock = this.idleLock;
+	if (isDisposed () || synchronizer == null || idleLock == null) error (SWT.ERROR_DEVICE_DISPOSED);
+	synchronized (idleLock) {
+		if (idleNeeded && idleHandle == 0) {
+			if (GTK.GTK4) {
+				idleHandle = OS.g_idle_add (idleProc, 0);
+			} else {
+				idleHandle = GDK.gdk_threads_add_idle (idleProc, 0);
 			}
 		}
 	}
@@ -6154,31 +6504,66 @@ boolean changeValue (long handle, int scroll, double value, long user_data) {
 long windowProc (long handle, long user_data) {
 	Widget widget = getWidget (handle);
 	if (widget == null) return 0;
-	return widget.windowProc (handle, user_data);
+	DispatchMonitor monitor = dispatchMonitor;
+	if (monitor == null) return widget.windowProc (handle, user_data);
+	long start = monitor.begin ((int) user_data);
+	try {
+		return widget.windowProc (handle, user_data);
+	} finally {
+		monitor.endSignal ((int) user_data, start);
+	}
 }
 
 long windowProc (long handle, long arg0, long user_data) {
 	Widget widget = getWidget (handle);
 	if (widget == null) return 0;
-	return widget.windowProc (handle, arg0, user_data);
+	DispatchMonitor monitor = dispatchMonitor;
+	if (monitor == null) return widget.windowProc (handle, arg0, user_data);
+	long start = monitor.begin ((int) user_data);
+	try {
+		return widget.windowProc (handle, arg0, user_data);
+	} finally {
+		monitor.endSignal ((int) user_data, start);
+	}
 }
 
 long windowProc (long handle, long arg0, long arg1, long user_data) {
 	Widget widget = getWidget (handle);
 	if (widget == null) return 0;
-	return widget.windowProc (handle, arg0, arg1, user_data);
+	DispatchMonitor monitor = dispatchMonitor;
+	if (monitor == null) return widget.windowProc (handle, arg0, arg1, user_data);
+	long start = monitor.begin ((int) user_data);
+	try {
+		return widget.windowProc (handle, arg0, arg1, user_data);
+	} finally {
+		monitor.endSignal ((int) user_data, start);
+	}
 }
 
 long windowProc (long handle, long arg0, long arg1, long arg2, long user_data) {
 	Widget widget = getWidget (handle);
 	if (widget == null) return 0;
-	return widget.windowProc (handle, arg0, arg1, arg2, user_data);
+	DispatchMonitor monitor = dispatchMonitor;
+	if (monitor == null) return widget.windowProc (handle, arg0, arg1, arg2, user_data);
+	long start = monitor.begin ((int) user_data);
+	try {
+		return widget.windowProc (handle, arg0, arg1, arg2, user_data);
+	} finally {
+		monitor.endSignal ((int) user_data, start);
+	}
 }
 
 long windowProc (long handle, long arg0, long arg1, long arg2, long arg3, long user_data) {
 	Widget widget = getWidget (handle);
 	if (widget == null) return 0;
-	return widget.windowProc (handle, arg0, arg1, arg2, arg3, user_data);
+	DispatchMonitor monitor = dispatchMonitor;
+	if (monitor == null) return widget.windowProc (handle, arg0, arg1, arg2, arg3, user_data);
+	long start = monitor.begin ((int) user_data);
+	try {
+		return widget.windowProc (handle, arg0, arg1, arg2, arg3, user_data);
+	} finally {
+		monitor.endSignal ((int) user_data, start);
+	}
 }
 
 long windowTimerProc (long handle) {
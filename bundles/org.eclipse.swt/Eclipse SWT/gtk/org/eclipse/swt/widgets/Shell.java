@@ -1,5 +1,5 @@
 /*******************************************************************************
- * Copyright (c) 2000, 2021 IBM Corporation and others.
+ * Copyright (c) 2000, 2026 IBM Corporation and others.
  *
  * This program and the accompanying materials
  * are made available under the terms of the Eclipse Public License 2.0
@@ -134,7 +134,12 @@ public class Shell extends Decorations {
 	boolean ignoreFocusOutAfterGrab, grabbedFocus;
 	Region originalRegion;
 
+	/* Invalidated areas of the controls in the shell, flushed once per frame */
+	Damage [] damages;
+	int damageCount;
+
 	static final int MAXIMUM_TRIM = 128;
+	static final int MAXIMUM_DAMAGE_RECTS = 4096;
 	static final int BORDER = 3;
 
 	static final double SHELL_TO_MONITOR_RATIO = 0.625; // Fractional: 5 / 8
@@ -442,6 +447,82 @@ static int checkStyle (Shell parent, int style) {
 	return bits;
 }
 
+/*
+* The invalidated areas of one control. Rectangles are stored as
+* x, y, width and height in a flat array, so that the damage is
+* passed to cairo_region_create_rectangles() in a single call.
+*/
+static final class Damage {
+	final Shell shell;
+	Control control;
+	boolean all, whole;
+	int [] rects = new int [64];
+	int count;
+
+	Damage (Shell shell) {
+		this.shell = shell;
+	}
+}
+
+/*
+* Adds an invalidated area of a control. Returns false if the area is
+* already covered by the damage of the control.
+*/
+boolean addDamage (Control control, int x, int y, int width, int height, boolean redrawAll, boolean all) {
+	Damage damage = all ? control.childDamage : control.damage;
+	/* The control may have been reparented since its damage was queued */
+	if (damage != null && (damage.shell != this || damage.control != control)) damage = null;
+	if (damage == null) {
+		if (damages == null) damages = new Damage [4];
+		if (damageCount == damages.length) {
+			Damage [] newDamages = new Damage [damageCount * 2];
+			System.arraycopy (damages, 0, newDamages, 0, damageCount);
+			damages = newDamages;
+		}
+		damage = damages [damageCount];
+		if (damage == null) damage = damages [damageCount] = new Damage (this);
+		damageCount++;
+		damage.control = control;
+		damage.all = all;
+		if (all) {
+			control.childDamage = damage;
+		} else {
+			control.damage = damage;
+		}
+		damage.whole = false;
+		damage.count = 0;
+	}
+	if (damage.whole) return false;
+	if (redrawAll) {
+		damage.whole = true;
+		damage.count = 0;
+		return true;
+	}
+	if (width <= 0 || height <= 0) return false;
+	int [] rects = damage.rects;
+	/* Drop rectangles inside one of the most recent ones, canvases tend to repeat them */
+	for (int i = damage.count - 4, end = Math.max (0, damage.count - 16); i >= end; i -= 4) {
+		if (rects [i] <= x && rects [i + 1] <= y && x + width <= rects [i] + rects [i + 2] && y + height <= rects [i + 1] + rects [i + 3]) {
+			return false;
+		}
+	}
+	if (damage.count == rects.length) {
+		if (rects.length == MAXIMUM_DAMAGE_RECTS * 4) {
+			flushDamage (damage);
+			damage.count = 0;
+		} else {
+			int [] newRects = new int [rects.length * 2];
+			System.arraycopy (rects, 0, newRects, 0, damage.count);
+			damage.rects = rects = newRects;
+		}
+	}
+	rects [damage.count++] = x;
+	rects [damage.count++] = y;
+	rects [damage.count++] = width;
+	rects [damage.count++] = height;
+	return true;
+}
+
 /**
  * Adds the listener to the collection of listeners who will
  * be notified when operations are performed on the receiver,
@@ -1066,6 +1147,43 @@ long paintHandle () {
 	}
 }
 
+/*
+* Invalidates the accumulated damage of all controls, one region per
+* control, and returns the number of regions.
+*/
+int flushDamage () {
+	int regions = 0;
+	for (int i = 0; i < damageCount; i++) {
+		Damage damage = damages [i];
+		if (flushDamage (damage)) regions++;
+		clearDamage (damage);
+	}
+	damageCount = 0;
+	return regions;
+}
+
+void clearDamage (Damage damage) {
+	Control control = damage.control;
+	if (control.damage == damage) control.damage = null;
+	if (control.childDamage == damage) control.childDamage = null;
+	damage.control = null;
+}
+
+boolean flushDamage (Damage damage) {
+	Control control = damage.control;
+	if (control.isDisposed () || !GTK.gtk_widget_get_realized (control.handle)) return false;
+	long window = control.paintWindow ();
+	if (damage.whole) {
+		GDK.gdk_window_invalidate_rect (window, null, damage.all);
+	} else {
+		if (damage.count == 0) return false;
+		long region = Cairo.cairo_region_create_rectangles (damage.rects, damage.count / 4);
+		GDK.gdk_window_invalidate_region (window, region, damage.all);
+		Cairo.cairo_region_destroy (region);
+	}
+	return true;
+}
+
 void fixActiveShell () {
 	// Only fix shell for SWT.ON_TOP set, see bug 568550
 	if (display.activeShell == this && (style & SWT.ON_TOP) != 0) {
@@ -3427,6 +3545,11 @@ void releaseWidget () {
 	if (group != 0) OS.g_object_unref (group);
 	group = modalGroup = 0;
 	lastActive = null;
+	for (int i = 0; i < damageCount; i++) {
+		clearDamage (damages [i]);
+	}
+	damages = null;
+	damageCount = 0;
 	if (regionToDispose != null) {
 		regionToDispose.dispose();
 	}
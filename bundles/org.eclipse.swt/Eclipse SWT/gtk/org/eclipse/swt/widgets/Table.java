@@ -1,5 +1,5 @@
 /*******************************************************************************
- * Copyright (c) 2000, 2022 IBM Corporation and others.
+ * Copyright (c) 2000, 2026 IBM Corporation and others.
  *
  * This program and the accompanying materials
  * are made available under the terms of the Eclipse Public License 2.0
@@ -76,7 +76,10 @@ import org.eclipse.swt.internal.gtk4.*;
  */
 public class Table extends Composite {
 	long modelHandle, checkRenderer;
-	int itemCount, columnCount, lastIndexOf, sortDirection;
+	int itemCount, columnCount, sortDirection;
+	/* The items before this index know their index, the others are renumbered when needed */
+	int indexStaleFrom;
+	long indexScanCount;
 	int selectionCountOnPress,selectionCountOnRelease;
 	long ignoreCell;
 	TableItem [] items;
@@ -98,6 +101,10 @@ public class Table extends Composite {
 	int headerHeight;
 	boolean boundsChangedSinceLastDraw, headerVisible, wasScrolled;
 	boolean rowActivated;
+	/* The widths measured by TableColumn.pack() stay valid while this is unchanged */
+	int packGeneration;
+	long packMeasureCount, packCacheHitCount;
+	int [] calculatedWidth = new int [1], calculatedPadding = new int [1];
 
 	private long headerCSSProvider;
 
@@ -171,7 +178,9 @@ void _addListener (int eventType, Listener listener) {
 TableItem _getItem (int index) {
 	if ((style & SWT.VIRTUAL) == 0) return items [index];
 	if (items [index] != null) return items [index];
-	return items [index] = new TableItem (this, SWT.NONE, index, false);
+	TableItem item = items [index] = new TableItem (this, SWT.NONE, index, false);
+	item.index = index;
+	return item;
 }
 
 static int checkStyle (int style) {
@@ -223,7 +232,6 @@ long cellDataProc (long tree_column, long cell, long tree_model, long iter, long
 	boolean setData = false;
 	if ((style & SWT.VIRTUAL) != 0) {
 		if (!item.cached) {
-			lastIndexOf = index[0];
 			setData = checkData (item);
 		}
 	}
@@ -347,7 +355,8 @@ int calculateWidth (long column, long iter) {
 	*/
 
 	//This workaround is causing the problem Bug 459834 in GTK3. So reverting the workaround for GTK3
-	int[] width = new int[1];
+	int[] width = calculatedWidth;
+	width[0] = 0;
 	if (GTK.GTK4) {
 		GTK4.gtk_tree_view_column_cell_get_size(column, null, null, width, null);
 	} else {
@@ -355,12 +364,45 @@ int calculateWidth (long column, long iter) {
 	}
 
 	long textRenderer = getTextRenderer(column);
-	int[] xpad = new int[1];
+	int[] xpad = calculatedPadding;
+	xpad[0] = 0;
 	if (textRenderer != 0) GTK.gtk_cell_renderer_get_padding(textRenderer, xpad, null);
 
 	return width[0] + xpad[0] * 2;
 }
 
+/*
+ * Returns the width of the widest cell of a column. Only the cells that
+ * changed since they were last measured are measured again. When the
+ * table has more rows than the pack sample size, only a sample of them
+ * is measured, together with the rows that were already measured.
+ */
+int calculatePackWidth (long column, int index) {
+	int width = 0;
+	int sampleSize = getPackSampleSize ();
+	if (sampleSize == 0 || itemCount <= sampleSize) {
+		for (int i=0; i<itemCount; i++) {
+			width = Math.max (width, items [i].getPackWidth (column, index));
+		}
+		return width;
+	}
+	int [] lengths = new int [itemCount];
+	for (int i=0; i<itemCount; i++) {
+		String [] strings = items [i].strings;
+		if (strings != null && index < strings.length && strings [index] != null) {
+			lengths [i] = strings [index].length ();
+		}
+	}
+	boolean [] sample = selectPackSample (lengths, itemCount, sampleSize);
+	for (int i=0; i<itemCount; i++) {
+		TableItem item = items [i];
+		int cellWidth = item.getCachedPackWidth (index);
+		if (cellWidth == -1 && sample [i]) cellWidth = item.getPackWidth (column, index);
+		width = Math.max (width, cellWidth);
+	}
+	return width;
+}
+
 /**
  * Clears the item at the given zero-relative index in the receiver.
  * The text, icon and other attributes of the item are set to the default
@@ -716,6 +758,7 @@ void createHandle (int index) {
 
 void createItem (TableColumn column, int index) {
 	if (!(0 <= index && index <= columnCount)) error (SWT.ERROR_INVALID_RANGE);
+	packGeneration++;
 	if (columnCount == 0) {
 		column.handle = GTK.gtk_tree_view_get_column (handle, 0);
 		GTK.gtk_tree_view_column_set_sizing (column.handle, GTK.GTK_TREE_VIEW_COLUMN_FIXED);
@@ -828,6 +871,8 @@ void createItem (TableItem item, int index) {
 	}
 	System.arraycopy (items, index, items, index + 1, itemCount++ - index);
 	items [index] = item;
+	item.index = index;
+	if (indexStaleFrom >= index) indexStaleFrom = index + 1;
 }
 
 void createRenderers (long columnHandle, int modelIndex, boolean check, int columnStyle) {
@@ -924,7 +969,7 @@ void createWidget (int index) {
 	super.createWidget (index);
 	items = new TableItem [4];
 	columns = new TableColumn [4];
-	itemCount = columnCount = 0;
+	itemCount = columnCount = indexStaleFrom = 0;
 	// In GTK 3 font description is inherited from parent widget which is not how SWT has always worked,
 	// reset to default font to get the usual behavior
 	setFontDescription(defaultFont().handle);
@@ -1056,6 +1101,7 @@ void destroyItem (TableColumn column) {
 		index++;
 	}
 	if (index == columnCount) return;
+	packGeneration++;
 	long columnHandle = column.handle;
 	if (columnCount == 1) {
 		firstCustomDraw = column.customDraw;
@@ -1121,18 +1167,15 @@ void destroyItem (TableColumn column) {
 }
 
 void destroyItem (TableItem item) {
-	int index = 0;
-	while (index < itemCount) {
-		if (items [index] == item) break;
-		index++;
-	}
-	if (index == itemCount) return;
+	int index = _indexOf (item);
+	if (index == -1) return;
 	long selection = GTK.gtk_tree_view_get_selection (handle);
 	OS.g_signal_handlers_block_matched (selection, OS.G_SIGNAL_MATCH_DATA, 0, 0, 0, 0, CHANGED);
 	GTK.gtk_list_store_remove (modelHandle, item.handle);
 	OS.g_signal_handlers_unblock_matched (selection, OS.G_SIGNAL_MATCH_DATA, 0, 0, 0, 0, CHANGED);
 	System.arraycopy (items, index + 1, items, index, --itemCount - index);
 	items [itemCount] = null;
+	indexStaleFrom = Math.min (indexStaleFrom, index);
 	if (itemCount == 0) resetCustomDraw ();
 }
 
@@ -2483,20 +2526,25 @@ public int indexOf (TableColumn column) {
 public int indexOf (TableItem item) {
 	checkWidget();
 	if (item == null) error (SWT.ERROR_NULL_ARGUMENT);
-	if (1 <= lastIndexOf && lastIndexOf < itemCount - 1) {
-		if (items [lastIndexOf] == item) return lastIndexOf;
-		if (items [lastIndexOf + 1] == item) return ++lastIndexOf;
-		if (items [lastIndexOf - 1] == item) return --lastIndexOf;
-	}
-	if (lastIndexOf < itemCount / 2) {
-		for (int i=0; i<itemCount; i++) {
-			if (items [i] == item) return lastIndexOf = i;
-		}
-	} else {
-		for (int i=itemCount - 1; i>=0; --i) {
-			if (items [i] == item) return lastIndexOf = i;
-		}
-	}
+	return _indexOf (item);
+}
+
+/*
+ * Every item remembers its index. Inserting or removing items only marks
+ * the indices of the items after the change as stale, and they are all
+ * renumbered by one scan the next time a stale index is needed.
+ */
+int _indexOf (TableItem item) {
+	int index = item.index;
+	if (0 <= index && index < itemCount && items [index] == item) return index;
+	if (item.parent != this || indexStaleFrom >= itemCount) return -1;
+	for (int i=indexStaleFrom; i<itemCount; i++) {
+		if (items [i] != null) items [i].index = i;
+	}
+	indexStaleFrom = itemCount;
+	indexScanCount++;
+	index = item.index;
+	if (0 <= index && index < itemCount && items [index] == item) return index;
 	return -1;
 }
 
@@ -2673,6 +2721,7 @@ public void remove (int index) {
 		OS.g_signal_handlers_unblock_matched (selection, OS.G_SIGNAL_MATCH_DATA, 0, 0, 0, 0, CHANGED);
 		System.arraycopy (items, index + 1, items, index, --itemCount - index);
 		items [itemCount] = null;
+		indexStaleFrom = Math.min (indexStaleFrom, index);
 	}
 	OS.g_free (iter);
 }
@@ -2721,6 +2770,7 @@ public void remove (int start, int end) {
 	System.arraycopy (items, index, items, start, itemCount - index);
 	for (int i=itemCount-(index-start); i<itemCount; i++) items [i] = null;
 	itemCount = itemCount - (index - start);
+	indexStaleFrom = Math.min (indexStaleFrom, start);
 }
 
 /**
@@ -2773,6 +2823,7 @@ public void remove (int [] indices) {
 				OS.g_signal_handlers_unblock_matched (selection, OS.G_SIGNAL_MATCH_DATA, 0, 0, 0, 0, CHANGED);
 				System.arraycopy (items, index + 1, items, index, --itemCount - index);
 				items [itemCount] = null;
+				indexStaleFrom = Math.min (indexStaleFrom, index);
 			}
 			last = index;
 		}
@@ -2798,7 +2849,7 @@ public void removeAll () {
 		--index;
 	}
 	items = new TableItem [4];
-	itemCount = 0;
+	itemCount = indexStaleFrom = 0;
 	long selection = GTK.gtk_tree_view_get_selection (handle);
 	OS.g_signal_handlers_block_matched (selection, OS.G_SIGNAL_MATCH_DATA, 0, 0, 0, 0, CHANGED);
 	/*
@@ -3496,6 +3547,7 @@ public void setColumnOrder (int [] order) {
 @Override
 void setFontDescription (long font) {
 	super.setFontDescription (font);
+	packGeneration++;
 	TableColumn[] columns = getColumns ();
 	for (int i = 0; i < columns.length; i++) {
 		if (columns[i] != null) {
@@ -3757,6 +3809,21 @@ public void setRedraw (boolean redraw) {
 	}
 }
 
+/*
+ * Returns the number of scans that renumbered the items for indexOf().
+ */
+long getIndexStatistics () {
+	return indexScanCount;
+}
+
+/*
+ * Returns the number of cells measured and the number of cached widths
+ * used by TableColumn.pack().
+ */
+long [] getPackStatistics () {
+	return new long [] {packMeasureCount, packCacheHitCount};
+}
+
 void setScrollWidth (long column, TableItem item) {
 	if (columnCount != 0 || currentItem == item) return;
 	int width = GTK.gtk_tree_view_column_get_fixed_width (column);
@@ -1,5 +1,5 @@
 /*******************************************************************************
- * Copyright (c) 2000, 2017 IBM Corporation and others.
+ * Copyright (c) 2000, 2026 IBM Corporation and others.
  *
  * This program and the accompanying materials
  * are made available under the terms of the Eclipse Public License 2.0
@@ -494,6 +494,7 @@ public void pack () {
 		} else {
 			calcWidth = true;
 		}
+		int index = parent.indexOf (this);
 		for (int i=0; i<parent.items.length; i++) {
 			TableItem item = parent.items [i];
 			if (itemBounds == null && item != null) itemBounds = item.getBounds();
@@ -504,17 +505,11 @@ public void pack () {
 				isVisible = (itemTopBound > 0 && itemBottomBound < tableHeight);
 			}
 			if (item != null && item.cached && (isVisible || calcWidth)) {
-				width = Math.max (width, parent.calculateWidth (handle, item.handle));
+				width = Math.max (width, item.getPackWidth (handle, index));
 			}
 		}
 	} else {
-		long iter = OS.g_malloc (GTK.GtkTreeIter_sizeof ());
-		if (GTK.gtk_tree_model_get_iter_first (parent.modelHandle, iter)) {
-			do {
-				width = Math.max (width, parent.calculateWidth (handle, iter));
-			} while (GTK.gtk_tree_model_iter_next(parent.modelHandle, iter));
-		}
-		OS.g_free (iter);
+		width = Math.max (width, parent.calculatePackWidth (handle, parent.indexOf (this)));
 	}
 	setWidthInPixels(width);
 }
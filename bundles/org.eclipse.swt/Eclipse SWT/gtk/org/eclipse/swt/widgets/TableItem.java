@@ -1,5 +1,5 @@
 /*******************************************************************************
- * Copyright (c) 2000, 2019 IBM Corporation and others.
+ * Copyright (c) 2000, 2026 IBM Corporation and others.
  *
  * This program and the accompanying materials
  * are made available under the terms of the Eclipse Public License 2.0
@@ -45,6 +45,11 @@ public class TableItem extends Item {
 	Font[] cellFont;
 	String [] strings;
 	boolean cached, grayed, settingData;
+	/* The index of the item, see Table._indexOf() */
+	int index;
+	/* The widths measured by TableColumn.pack() plus one, 0 when not measured */
+	int [] packWidths;
+	int packGeneration;
 
 /**
  * Constructs a new instance of this class given its parent
@@ -237,6 +242,41 @@ void clear () {
 	font = null;
 	cellFont = null;
 	strings = null;
+	packWidths = null;
+}
+
+/*
+ * Returns the width of the cell measured for TableColumn.pack(), or -1 if
+ * the cell changed since it was last measured. Widths are not kept while
+ * the parent has MeasureItem listeners, which can report a different width
+ * without any change to the cell.
+ */
+int getCachedPackWidth (int index) {
+	if (parent.hooks (SWT.MeasureItem)) return -1;
+	if (packWidths == null || packGeneration != parent.packGeneration) return -1;
+	if (index >= packWidths.length) return -1;
+	return packWidths [index] - 1;
+}
+
+/*
+ * Returns the width of the cell measured by Table.calculateWidth(), which is
+ * only called again when the cell changed since it was last measured.
+ */
+int getPackWidth (long column, int index) {
+	int width = getCachedPackWidth (index);
+	if (width != -1) {
+		parent.packCacheHitCount++;
+		return width;
+	}
+	width = parent.calculateWidth (column, handle);
+	parent.packMeasureCount++;
+	if (parent.hooks (SWT.MeasureItem)) return width;
+	if (packWidths == null || packGeneration != parent.packGeneration || index >= packWidths.length) {
+		packWidths = new int [Math.max (index + 1, parent.columnCount)];
+		packGeneration = parent.packGeneration;
+	}
+	packWidths [index] = width + 1;
+	return width;
 }
 
 @Override
@@ -983,6 +1023,7 @@ public void setFont (Font font){
 	long fontHandle = font != null ? font.handle : 0;
 	GTK.gtk_list_store_set (parent.modelHandle, handle, Table.FONT_COLUMN, fontHandle, -1);
 	cached = true;
+	packWidths = null;
 }
 
 /**
@@ -1024,6 +1065,7 @@ public void setFont (int index, Font font) {
 	long fontHandle  = font != null ? font.handle : 0;
 	GTK.gtk_list_store_set (parent.modelHandle, handle, modelIndex + Table.CELL_FONT, fontHandle, -1);
 	cached = true;
+	packWidths = null;
 
 	if (font != null) {
 		boolean customDraw = (parent.columnCount == 0)  ? parent.firstCustomDraw : parent.columns [index].customDraw;
@@ -1221,6 +1263,7 @@ public void setImage(int index, Image image) {
 			}
 			if (iWidth > currentWidth [0] || iHeight > currentHeight [0]) {
 				GTK.gtk_cell_renderer_set_fixed_size (pixbufRenderer, iWidth, iHeight);
+				parent.packGeneration++;
 				parent.pixbufHeight = iHeight;
 				parent.pixbufWidth = iWidth;
 				parent.pixbufSizeSet = true;
@@ -1235,6 +1278,7 @@ public void setImage(int index, Image image) {
 		 */
 		if (parent.pixbufWidth > Math.max(currentWidth [0], 0) || parent.pixbufHeight > Math.max(currentHeight [0], 0)) {
 			GTK.gtk_cell_renderer_set_fixed_size (pixbufRenderer, parent.pixbufWidth, parent.pixbufHeight);
+			parent.packGeneration++;
 		}
 	}
 	int modelIndex = parent.columnCount == 0 ? Table.FIRST_COLUMN : parent.columns [index].modelIndex;
@@ -1248,6 +1292,7 @@ public void setImage(int index, Image image) {
 	}
 	GTK.gtk_list_store_set (parent.modelHandle, handle, modelIndex + Table.CELL_SURFACE, surface, -1);
 	cached = true;
+	packWidths = null;
 	/*
 	 * Bug 465056: single column Tables have a very small initial width.
 	 * Fix: when text or an image is set for a Table, compute its
@@ -1346,6 +1391,7 @@ public void setText (int index, String string) {
 	int modelIndex = parent.columnCount == 0 ? Table.FIRST_COLUMN : parent.columns [index].modelIndex;
 	GTK.gtk_list_store_set (parent.modelHandle, handle, modelIndex + Table.CELL_TEXT, buffer, -1);
 	cached = true;
+	packWidths = null;
 	/*
 	 * Bug 465056: single column Tables have a very small initial width.
 	 * Fix: when text or an image is set for a Table, compute its
@@ -1383,9 +1429,53 @@ public void setText (String string) {
 public void setText (String [] strings) {
 	checkWidget ();
 	if (strings == null) error (SWT.ERROR_NULL_ARGUMENT);
-	for (int i=0; i<strings.length; i++) {
+	if (this.strings != null && !parent.checkData (this)) error (SWT.ERROR_WIDGET_DISPOSED);
+	/*
+	* The changed texts are stored in the model by a single native call,
+	* which converts them to UTF-8 and emits row-changed once for the row
+	* rather than once for every column.
+	*/
+	int count = Math.max (1, parent.getColumnCount ());
+	int length = Math.min (strings.length, count), changed = 0, size = 0;
+	int [] columns = new int [length], lengths = new int [length];
+	String [] texts = new String [length];
+	for (int i=0; i<length; i++) {
 		String string = strings [i];
-		if (string != null) setText (i, string);
+		if (string == null) continue;
+		/* Rows without strings have no text in the model */
+		if (this.strings == null) {
+			if (string.isEmpty ()) continue;
+			this.strings = new String [count];
+		} else if (string.equals (this.strings [i] != null ? this.strings [i] : "")) {
+			continue;
+		}
+		this.strings [i] = string;
+		if (string.length () > TEXT_LIMIT) {
+			string = string.substring (0, TEXT_LIMIT - ELLIPSIS.length ()) + ELLIPSIS;
+		}
+		int modelIndex = parent.columnCount == 0 ? Table.FIRST_COLUMN : parent.columns [i].modelIndex;
+		columns [changed] = modelIndex + Table.CELL_TEXT;
+		lengths [changed] = string.length ();
+		texts [changed++] = string;
+		size += string.length ();
+	}
+	if (changed == 0) return;
+	char [] buffer = new char [size];
+	for (int i=0, offset=0; i<changed; i++) {
+		texts [i].getChars (0, lengths [i], buffer, offset);
+		offset += lengths [i];
+	}
+	OS.swt_list_store_set_texts (parent.modelHandle, handle, columns, buffer, lengths, changed);
+	cached = true;
+	packWidths = null;
+	/*
+	 * Bug 465056: single column Tables have a very small initial width.
+	 * Fix: when text or an image is set for a Table, compute its
+	 * width and see if it's larger than the maximum of the previous widths.
+	 */
+	if (parent.columnCount == 0) {
+		long column = GTK.gtk_tree_view_get_column (parent.handle, 0);
+		parent.maxWidth = Math.max(parent.maxWidth, parent.calculateWidth(column, this.handle));
 	}
 }
 }
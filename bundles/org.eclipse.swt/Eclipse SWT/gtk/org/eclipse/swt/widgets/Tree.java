@@ -1,5 +1,5 @@
 /*******************************************************************************
- * Copyright (c) 2000, 2022 IBM Corporation and others.
+ * Copyright (c) 2000, 2026 IBM Corporation and others.
  *
  * This program and the accompanying materials
  * are made available under the terms of the Eclipse Public License 2.0
@@ -13,6 +13,8 @@
  *******************************************************************************/
 package org.eclipse.swt.widgets;
 
+import java.util.*;
+
 
 import org.eclipse.swt.*;
 import org.eclipse.swt.events.*;
@@ -108,6 +110,12 @@ public class Tree extends Composite {
 	Color headerBackground, headerForeground;
 	boolean boundsChangedSinceLastDraw, wasScrolled;
 	boolean rowActivated;
+	/* The widths measured by TreeColumn.pack() stay valid while this is unchanged */
+	int packGeneration;
+	long packMeasureCount, packCacheHitCount;
+	/* The indices cached by the items stay valid while this is unchanged */
+	int indexGeneration = 1, staleIndexCount;
+	long indexScanCount, indexPathCount;
 
 	private long headerCSSProvider;
 
@@ -125,6 +133,8 @@ public class Tree extends Composite {
 	static final int CELL_FONT = 4;
 	static final int CELL_SURFACE = 5;
 	static final int CELL_TYPES = CELL_SURFACE + 1;
+	/* Stale indices looked up from paths before the siblings are renumbered */
+	static final int STALE_INDEX_LIMIT = 8;
 
 /**
  * Constructs a new instance of this class given its parent
@@ -200,10 +210,15 @@ TreeItem _getItem (long iter) {
 TreeItem _getItem (long parentIter, int index) {
 	long iter = OS.g_malloc (GTK.GtkTreeIter_sizeof ());
 	GTK.gtk_tree_model_iter_nth_child(modelHandle, iter, parentIter, index);
-	int id = getId (iter, true);
+	TreeItem item = _getItem (parentIter, iter, index);
 	OS.g_free (iter);
+	return item;
+}
+
+TreeItem _getItem (long parentIter, long iter, int index) {
+	int id = getId (iter, true);
 	if (items [id] != null) return items [id];
-	return items [id] = new TreeItem (this, parentIter, SWT.NONE, index, false);
+	return items [id] = new TreeItem (this, parentIter, iter, index);
 }
 
 void reallocateIds(int newSize) {
@@ -544,6 +559,73 @@ int calculateWidth (long column, long iter, boolean recurse) {
 	return width;
 }
 
+/*
+ * Returns the width of the widest cell of a column in the rows that are
+ * not inside collapsed items. In a virtual tree only the rows whose data
+ * has been set are measured. Only the cells that changed since they were
+ * last measured are measured again. When there are more rows than the pack
+ * sample size, only a sample of them is measured, together with the rows
+ * that were already measured.
+ */
+int calculatePackWidth (long column, int index) {
+	ArrayList<TreeItem> rows = new ArrayList<> ();
+	addPackItems (0, rows, (style & SWT.VIRTUAL) != 0);
+	int count = rows.size (), width = 0;
+	int sampleSize = getPackSampleSize ();
+	if (sampleSize == 0 || count <= sampleSize) {
+		for (int i=0; i<count; i++) {
+			width = Math.max (width, rows.get (i).getPackWidth (column, index));
+		}
+		return width;
+	}
+	int [] lengths = new int [count];
+	for (int i=0; i<count; i++) {
+		String [] strings = rows.get (i).strings;
+		if (strings != null && index < strings.length && strings [index] != null) {
+			lengths [i] = strings [index].length ();
+		}
+	}
+	boolean [] sample = selectPackSample (lengths, count, sampleSize);
+	for (int i=0; i<count; i++) {
+		TreeItem item = rows.get (i);
+		int cellWidth = item.getCachedPackWidth (index);
+		if (cellWidth == -1 && sample [i]) cellWidth = item.getPackWidth (column, index);
+		width = Math.max (width, cellWidth);
+	}
+	return width;
+}
+
+/*
+* Adds the items of the rows below the given row that are not inside
+* collapsed items. With cachedOnly, no items are created and only the
+* items whose data has been set are added, as in a virtual tree.
+*/
+void addPackItems (long parentIter, ArrayList<TreeItem> rows, boolean cachedOnly) {
+	long iter = OS.g_malloc (GTK.GtkTreeIter_sizeof ());
+	int [] id = cachedOnly ? new int [1] : null;
+	boolean valid = GTK.gtk_tree_model_iter_children (modelHandle, iter, parentIter);
+	while (valid) {
+		TreeItem item;
+		if (cachedOnly) {
+			GTK.gtk_tree_model_get (modelHandle, iter, ID_COLUMN, id, -1);
+			item = id [0] != -1 ? items [id [0]] : null;
+			if (item != null && item.cached) rows.add (item);
+		} else {
+			item = _getItem (iter);
+			rows.add (item);
+		}
+		/* A row without an item can only have been expanded natively */
+		if (item == null || item.isExpanded) {
+			long path = GTK.gtk_tree_model_get_path (modelHandle, iter);
+			boolean expanded = GTK.gtk_tree_view_row_expanded (handle, path);
+			GTK.gtk_tree_path_free (path);
+			if (expanded) addPackItems (iter, rows, cachedOnly);
+		}
+		valid = GTK.gtk_tree_model_iter_next (modelHandle, iter);
+	}
+	OS.g_free (iter);
+}
+
 /**
  * Clears the item at the given zero-relative index in the receiver.
  * The text, icon and other attributes of the item are set to the default
@@ -908,6 +990,7 @@ int applyThemeBackground () {
 
 void createItem (TreeColumn column, int index) {
 	if (!(0 <= index && index <= columnCount)) error (SWT.ERROR_INVALID_RANGE);
+	packGeneration++;
 	if (index == 0) {
 		// first column must be left aligned
 		column.style &= ~(SWT.LEFT | SWT.RIGHT | SWT.CENTER);
@@ -1002,6 +1085,7 @@ void createItem (TreeItem item, long parentIter, int index) {
 		item.handle = OS.g_malloc (GTK.GtkTreeIter_sizeof ());
 		if (item.handle == 0) error(SWT.ERROR_NO_HANDLES);
 		GTK.gtk_tree_store_prepend (modelHandle, item.handle, parentIter);
+		invalidateIndices ();
 	} else if (index == -1) {
 		item.handle = OS.g_malloc (GTK.GtkTreeIter_sizeof ());
 		if (item.handle == 0) error(SWT.ERROR_NO_HANDLES);
@@ -1021,11 +1105,16 @@ void createItem (TreeItem item, long parentIter, int index) {
 			GTK.gtk_tree_store_append (modelHandle, item.handle, parentIter);
 		} else {
 			GTK.gtk_tree_store_insert (modelHandle, item.handle, parentIter, index);
+			invalidateIndices ();
 		}
 	}
 
 	int id = getId (item.handle, false);
 	items [id] = item;
+	if (index != -1) {
+		item.index = index;
+		item.indexGeneration = indexGeneration;
+	}
 	modelChanged = true;
 
 	if (parentIter == 0 ) {
@@ -1227,6 +1316,7 @@ void destroyItem (TreeColumn column) {
 		index++;
 	}
 	if (index == columnCount) return;
+	packGeneration++;
 	long columnHandle = column.handle;
 	if (columnCount == 1) {
 		firstCustomDraw = column.customDraw;
@@ -1291,6 +1381,7 @@ void destroyItem (TreeItem item) {
 	OS.g_signal_handlers_block_matched (selection, OS.G_SIGNAL_MATCH_DATA, 0, 0, 0, 0, CHANGED);
 	GTK.gtk_tree_store_remove (modelHandle, item.handle);
 	OS.g_signal_handlers_unblock_matched (selection, OS.G_SIGNAL_MATCH_DATA, 0, 0, 0, 0, CHANGED);
+	invalidateIndices ();
 	modelChanged = true;
 
 	/*
@@ -1924,28 +2015,50 @@ public TreeItem [] getItems () {
 }
 
 TreeItem [] getItems (long parent) {
-	int length = GTK.gtk_tree_model_iter_n_children (modelHandle, parent);
-	TreeItem[] result = new TreeItem [length];
-	if (length == 0) return result;
-	if ((style & SWT.VIRTUAL) != 0) {
-		for (int i=0; i<length; i++) {
-			result [i] = _getItem (parent, i);
-		}
-	} else {
-		int i = 0;
-		int[] index = new int [1];
-		long iter = OS.g_malloc (GTK.GtkTreeIter_sizeof ());
-		boolean valid = GTK.gtk_tree_model_iter_children (modelHandle, iter, parent);
-		while (valid) {
-			GTK.gtk_tree_model_get (modelHandle, iter, ID_COLUMN, index, -1);
-			result [i++] = items [index [0]];
-			valid = GTK.gtk_tree_model_iter_next (modelHandle, iter);
+	int [] ids = getChildIds (parent);
+	TreeItem[] result = new TreeItem [ids.length];
+	/*
+	 * Rows of a virtual tree that have no item yet are visited with an
+	 * iterator that only moves forward, so that creating their items does
+	 * not look up the nth child of the parent for every row.
+	 */
+	long iter = 0;
+	int iterIndex = 0;
+	for (int i=0; i<ids.length; i++) {
+		TreeItem item = ids [i] != -1 ? items [ids [i]] : null;
+		if (item == null) {
+			if (iter == 0) {
+				iter = OS.g_malloc (GTK.GtkTreeIter_sizeof ());
+				if (iter == 0) error (SWT.ERROR_NO_HANDLES);
+				GTK.gtk_tree_model_iter_nth_child (modelHandle, iter, parent, i);
+			} else {
+				while (iterIndex < i) {
+					GTK.gtk_tree_model_iter_next (modelHandle, iter);
+					iterIndex++;
+				}
+			}
+			iterIndex = i;
+			item = _getItem (parent, iter, i);
 		}
-		OS.g_free (iter);
+		item.index = i;
+		item.indexGeneration = indexGeneration;
+		result [i] = item;
 	}
+	if (iter != 0) OS.g_free (iter);
 	return result;
 }
 
+/*
+ * Returns the ID_COLUMN values of all children of the given row, or of the
+ * root rows when it is 0. The model is walked once by a single native call.
+ */
+int [] getChildIds (long parentIter) {
+	int length = GTK.gtk_tree_model_iter_n_children (modelHandle, parentIter);
+	int [] ids = new int [length];
+	if (length > 0) OS.swt_tree_model_get_child_ids (modelHandle, parentIter, ID_COLUMN, ids, length);
+	return ids;
+}
+
 /**
  * Returns <code>true</code> if the receiver's lines are visible,
  * and <code>false</code> otherwise. Note that some platforms draw
@@ -2793,19 +2906,18 @@ public int indexOf (TreeItem item) {
 	checkWidget();
 	if (item == null) error (SWT.ERROR_NULL_ARGUMENT);
 	if (item.isDisposed()) error (SWT.ERROR_INVALID_ARGUMENT);
-	int index = -1;
-	long path = GTK.gtk_tree_model_get_path (modelHandle, item.handle);
-	int depth = GTK.gtk_tree_path_get_depth (path);
-	if (depth == 1) {
-		long indices = GTK.gtk_tree_path_get_indices (path);
-		if (indices != 0) {
-			int[] temp = new int[1];
-			C.memmove (temp, indices, 4);
-			index = temp[0];
-		}
-	}
-	GTK.gtk_tree_path_free (path);
-	return index;
+	if (item.parent != this) return -1;
+	int index = item._getIndex ();
+	return item._getParentItem () == null ? index : -1;
+}
+
+/*
+ * Inserting or removing items shifts the indices of their siblings, so
+ * all indices cached by the items become stale.
+ */
+void invalidateIndices () {
+	indexGeneration++;
+	staleIndexCount = 0;
 }
 
 @Override
@@ -2886,6 +2998,27 @@ void register () {
 	display.addWidget (modelHandle, this);
 }
 
+/*
+ * Stores the index of every child of the given item, or of every root
+ * item when it is null, in one scan of the model.
+ */
+void renumberItems (TreeItem parentItem) {
+	int depth = parentItem == null ? 1 : parentItem.depth != 0 ? parentItem.depth + 1 : 0;
+	int [] ids = getChildIds (parentItem != null ? parentItem.handle : 0);
+	for (int i=0; i<ids.length; i++) {
+		TreeItem item = ids [i] != -1 ? items [ids [i]] : null;
+		if (item != null) {
+			item.index = i;
+			item.indexGeneration = indexGeneration;
+			if (item.depth == 0 && depth != 0) {
+				item.parentItem = parentItem;
+				item.depth = depth;
+			}
+		}
+	}
+	indexScanCount++;
+}
+
 void releaseItem (TreeItem item, boolean release) {
 	int [] index = new int [1];
 	GTK.gtk_tree_model_get (modelHandle, item.handle, ID_COLUMN, index, -1);
@@ -2954,6 +3087,7 @@ void remove (long parentIter, int start, int end) {
 	if (!(0 <= start && start <= end && end < itemCount)) {
 		error (SWT.ERROR_INVALID_RANGE);
 	}
+	invalidateIndices ();
 	long selection = GTK.gtk_tree_view_get_selection (handle);
 	long iter = OS.g_malloc (GTK.GtkTreeIter_sizeof ());
 	if (iter == 0) error (SWT.ERROR_NO_HANDLES);
@@ -3000,6 +3134,7 @@ public void removeAll () {
 	OS.g_signal_handlers_block_matched (selection, OS.G_SIGNAL_MATCH_DATA, 0, 0, 0, 0, CHANGED);
 
 	GTK.gtk_tree_store_clear (modelHandle);
+	invalidateIndices ();
 
 	OS.g_signal_handlers_unblock_matched (selection, OS.G_SIGNAL_MATCH_DATA, 0, 0, 0, 0, CHANGED);
 
@@ -3501,6 +3636,42 @@ public void setInsertMark (TreeItem item, boolean before) {
 	GTK.gtk_tree_path_free (path [0]);
 }
 
+/*
+ * Sets the expanded state of the items below the given row. When create is
+ * set, the missing items of a virtual tree are created and their data is
+ * requested. When expandRows is set, the rows of the items are expanded
+ * one level at a time, so that rows without items are left collapsed.
+ * Returns the number of children of the row.
+ */
+int setSubtreeExpanded (long parentIter, boolean expanded, boolean create, boolean expandRows) {
+	TreeItem [] children;
+	if (create) {
+		children = getItems (parentIter);
+	} else {
+		int [] ids = getChildIds (parentIter);
+		children = new TreeItem [ids.length];
+		for (int i=0; i<ids.length; i++) {
+			if (ids [i] != -1) children [i] = items [ids [i]];
+		}
+	}
+	for (TreeItem child : children) {
+		if (child == null) continue;
+		if (create && !checkData (child)) {
+			if (isDisposed ()) break;
+			continue;
+		}
+		if (expandRows) {
+			long path = GTK.gtk_tree_model_get_path (modelHandle, child.handle);
+			GTK.gtk_tree_view_expand_row (handle, path, false);
+			GTK.gtk_tree_path_free (path);
+		}
+		int count = setSubtreeExpanded (child.handle, expanded, create, expandRows);
+		if (isDisposed ()) break;
+		if (count != 0 || !expanded) child.isExpanded = expanded;
+	}
+	return children.length;
+}
+
 void setItemCount (long parentIter, int count) {
 	int itemCount = GTK.gtk_tree_model_iter_n_children (modelHandle, parentIter);
 	if (count == itemCount) return;
@@ -3709,6 +3880,7 @@ public void setColumnOrder (int [] order) {
 @Override
 void setFontDescription (long font) {
 	super.setFontDescription (font);
+	packGeneration++;
 	TreeColumn[] columns = getColumns ();
 	for (int i = 0; i < columns.length; i++) {
 		if (columns[i] != null) {
@@ -3924,6 +4096,22 @@ void setParentGdkResource (Control child) {
 	}
 }
 
+/*
+ * Returns the number of scans that renumbered the children of an item and
+ * the number of indices looked up from the path of an item.
+ */
+long [] getIndexStatistics () {
+	return new long [] {indexScanCount, indexPathCount};
+}
+
+/*
+ * Returns the number of cells measured and the number of cached widths
+ * used by TreeColumn.pack().
+ */
+long [] getPackStatistics () {
+	return new long [] {packMeasureCount, packCacheHitCount};
+}
+
 void setScrollWidth (long column, TreeItem item) {
 	if (columnCount != 0 || currentItem == item) return;
 	int width = GTK.gtk_tree_view_column_get_fixed_width (column);
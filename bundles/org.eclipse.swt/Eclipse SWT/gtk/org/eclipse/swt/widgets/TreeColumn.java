@@ -1,5 +1,5 @@
 /*******************************************************************************
- * Copyright (c) 2000, 2016 IBM Corporation and others.
+ * Copyright (c) 2000, 2026 IBM Corporation and others.
  *
  * This program and the accompanying materials
  * are made available under the terms of the Eclipse Public License 2.0
@@ -478,22 +478,7 @@ public void pack () {
 		gtk_widget_get_preferred_size (buttonHandle, requisition);
 		width = requisition.width;
 	}
-	if ((parent.style & SWT.VIRTUAL) != 0) {
-		for (int i=0; i<parent.items.length; i++) {
-			TreeItem item = parent.items [i];
-			if (item != null && item.cached) {
-				width = Math.max (width, parent.calculateWidth (handle, item.handle, true));
-			}
-		}
-	} else {
-		long iter = OS.g_malloc (GTK.GtkTreeIter_sizeof ());
-		if (GTK.gtk_tree_model_get_iter_first (parent.modelHandle, iter)) {
-			do {
-				width = Math.max (width, parent.calculateWidth (handle, iter, true));
-			} while (GTK.gtk_tree_model_iter_next(parent.modelHandle, iter));
-		}
-		OS.g_free (iter);
-	}
+	width = Math.max (width, parent.calculatePackWidth (handle, parent.indexOf (this)));
 	setWidthInPixels(width);
 }
 
@@ -1,5 +1,5 @@
 /*******************************************************************************
- * Copyright (c) 2000, 2019 IBM Corporation and others.
+ * Copyright (c) 2000, 2026 IBM Corporation and others.
  *
  * This program and the accompanying materials
  * are made available under the terms of the Eclipse Public License 2.0
@@ -45,6 +45,14 @@ public class TreeItem extends Item {
 	Font[] cellFont;
 	String [] strings;
 	boolean cached, grayed, isExpanded, updated, settingData;
+	/* The widths measured by TreeColumn.pack() plus one, 0 when not measured */
+	int [] packWidths;
+	int packGeneration;
+	/* The index of the item, valid while indexGeneration matches the tree */
+	int index, indexGeneration;
+	/* The parent item and the depth of the item, depth is 0 until known */
+	TreeItem parentItem;
+	int depth;
 	static final int EXPANDER_EXTRA_PADDING = 4;
 
 /**
@@ -164,14 +172,27 @@ public TreeItem (TreeItem parentItem, int style, int index) {
 TreeItem (Tree parent, long parentIter, int style, int index, boolean create) {
 	super (parent, style);
 	this.parent = parent;
+	if (parentIter == 0) depth = 1;
 	if (create) {
 		parent.createItem (this, parentIter, index);
 	} else {
 		handle = OS.g_malloc (GTK.GtkTreeIter_sizeof ());
 		GTK.gtk_tree_model_iter_nth_child (parent.modelHandle, handle, parentIter, index);
+		this.index = index;
+		indexGeneration = parent.indexGeneration;
 	}
 }
 
+TreeItem (Tree parent, long parentIter, long iter, int index) {
+	super (parent, SWT.NONE);
+	this.parent = parent;
+	if (parentIter == 0) depth = 1;
+	handle = OS.g_malloc (GTK.GtkTreeIter_sizeof ());
+	C.memmove (handle, iter, GTK.GtkTreeIter_sizeof ());
+	this.index = index;
+	indexGeneration = parent.indexGeneration;
+}
+
 static int checkIndex (int index) {
 	if (index < 0) SWT.error (SWT.ERROR_INVALID_RANGE);
 	return index;
@@ -291,6 +312,41 @@ void clear () {
 	font = null;
 	strings = null;
 	cellFont = null;
+	packWidths = null;
+}
+
+/*
+ * Returns the width of the cell measured for TreeColumn.pack(), or -1 if
+ * the cell changed since it was last measured. Widths are not kept while
+ * the parent has MeasureItem listeners, which can report a different width
+ * without any change to the cell.
+ */
+int getCachedPackWidth (int index) {
+	if (parent.hooks (SWT.MeasureItem)) return -1;
+	if (packWidths == null || packGeneration != parent.packGeneration) return -1;
+	if (index >= packWidths.length) return -1;
+	return packWidths [index] - 1;
+}
+
+/*
+ * Returns the width of the cell measured by Tree.calculateWidth(), which is
+ * only called again when the cell changed since it was last measured.
+ */
+int getPackWidth (long column, int index) {
+	int width = getCachedPackWidth (index);
+	if (width != -1) {
+		parent.packCacheHitCount++;
+		return width;
+	}
+	width = parent.calculateWidth (column, handle, false);
+	parent.packMeasureCount++;
+	if (parent.hooks (SWT.MeasureItem)) return width;
+	if (packWidths == null || packGeneration != parent.packGeneration || index >= packWidths.length) {
+		packWidths = new int [Math.max (index + 1, parent.columnCount)];
+		packGeneration = parent.packGeneration;
+	}
+	packWidths [index] = width + 1;
+	return width;
 }
 
 /**
@@ -858,19 +914,33 @@ public Tree getParent () {
  */
 public TreeItem getParentItem () {
 	checkWidget();
+	return _getParentItem ();
+}
+
+/*
+ * Looks up the index of the receiver, and its parent item and depth when
+ * not known yet, from the path of the receiver.
+ */
+void updatePath () {
 	long path = GTK.gtk_tree_model_get_path (parent.modelHandle, handle);
-	TreeItem item = null;
 	int depth = GTK.gtk_tree_path_get_depth (path);
-	if (depth > 1) {
-		GTK.gtk_tree_path_up (path);
-		long iter = OS.g_malloc (GTK.GtkTreeIter_sizeof ());
-		if (GTK.gtk_tree_model_get_iter (parent.modelHandle, iter, path)) {
-			item = parent._getItem (iter);
+	int [] indices = new int [depth];
+	C.memmove (indices, GTK.gtk_tree_path_get_indices (path), 4 * depth);
+	index = indices [depth - 1];
+	indexGeneration = parent.indexGeneration;
+	parent.indexPathCount++;
+	if (this.depth == 0) {
+		if (depth > 1) {
+			GTK.gtk_tree_path_up (path);
+			long iter = OS.g_malloc (GTK.GtkTreeIter_sizeof ());
+			if (GTK.gtk_tree_model_get_iter (parent.modelHandle, iter, path)) {
+				parentItem = parent._getItem (iter);
+			}
+			OS.g_free (iter);
 		}
-		OS.g_free (iter);
+		this.depth = depth;
 	}
 	GTK.gtk_tree_path_free (path);
-	return item;
 }
 
 @Override
@@ -1030,30 +1100,37 @@ public int indexOf (TreeItem item) {
 	checkWidget();
 	if (item == null) error (SWT.ERROR_NULL_ARGUMENT);
 	if (item.isDisposed()) error (SWT.ERROR_INVALID_ARGUMENT);
-	int index = -1;
-	boolean isParent = false;
-	long currentPath = GTK.gtk_tree_model_get_path (parent.modelHandle, handle);
-	long parentPath = GTK.gtk_tree_model_get_path (parent.modelHandle, item.handle);
-	int depth = GTK.gtk_tree_path_get_depth (parentPath);
-	if (depth > 1 && GTK.gtk_tree_path_up(parentPath)) {
-		if (GTK.gtk_tree_path_compare(currentPath, parentPath) == 0) isParent = true;
-	}
-	GTK.gtk_tree_path_free (currentPath);
-	GTK.gtk_tree_path_free (parentPath);
-	if (!isParent) return index;
-	long path = GTK.gtk_tree_model_get_path (parent.modelHandle, item.handle);
-	if (depth > 1) {
-		long indices = GTK.gtk_tree_path_get_indices (path);
-		if (indices != 0) {
-			int[] temp = new int[depth];
-			C.memmove (temp, indices, 4 * temp.length);
-			index = temp[temp.length - 1];
-		}
+	if (item.parent != parent) return -1;
+	int index = item._getIndex ();
+	return item._getParentItem () == this ? index : -1;
+}
+
+/*
+ * Returns the index of the receiver among its siblings. The index is
+ * cached until items are inserted or removed in the tree. The first few
+ * stale indices are looked up from the paths of the items, after that
+ * all siblings of an item with a stale index are renumbered at once.
+ */
+int _getIndex () {
+	if (indexGeneration == parent.indexGeneration) return index;
+	if (parent.staleIndexCount < Tree.STALE_INDEX_LIMIT) {
+		parent.staleIndexCount++;
+		updatePath ();
+	} else {
+		parent.renumberItems (_getParentItem ());
 	}
-	GTK.gtk_tree_path_free (path);
 	return index;
 }
 
+/*
+ * Items never move to another parent, so the parent item is looked up
+ * only once.
+ */
+TreeItem _getParentItem () {
+	if (depth == 0) updatePath ();
+	return parentItem;
+}
+
 @Override
 void releaseChildren (boolean destroy) {
 	if (destroy) {
@@ -1108,6 +1185,7 @@ public void removeAll () {
 	if (iter == 0) error (SWT.ERROR_NO_HANDLES);
 	long selection = GTK.gtk_tree_view_get_selection (parent.handle);
 	int [] value = new int [1];
+	parent.invalidateIndices ();
 	while (GTK.gtk_tree_model_iter_children (modelHandle, iter, handle)) {
 		GTK.gtk_tree_model_get (modelHandle, iter, Tree.ID_COLUMN, value, -1);
 		TreeItem item = value [0] != -1 ? parent.items [value [0]] : null;
@@ -1263,6 +1341,72 @@ public void setExpanded (boolean expanded) {
 	isExpanded = expanded;
 }
 
+/**
+ * Sets the expanded state of the receiver and of all its descendants.
+ * <p>
+ * A single <code>SWT.Expand</code> or <code>SWT.Collapse</code> event is sent
+ * for the receiver before the state changes, with the detail field set to
+ * <code>SWT.ALL</code>. Listeners that create the children of an item when
+ * it is expanded must create the whole subtree in response to this event.
+ * </p><p>
+ * When <code>preload</code> is <code>true</code> and the tree was created
+ * with the <code>SWT.VIRTUAL</code> style, the items of the subtree are
+ * created and their data is requested before the subtree is shown, instead
+ * of one by one while the rows are drawn.
+ * </p>
+ *
+ * @param expanded the new expanded state
+ * @param preload whether to request the data of the items of a virtual subtree up front
+ *
+ * @exception SWTException <ul>
+ *    <li>ERROR_WIDGET_DISPOSED - if the receiver has been disposed</li>
+ *    <li>ERROR_THREAD_INVALID_ACCESS - if not called from the thread that created the receiver</li>
+ * </ul>
+ *
+ * @see #setExpanded(boolean)
+ *
+ * @since 3.122
+ */
+public void setSubtreeExpanded (boolean expanded, boolean preload) {
+	checkWidget();
+	Event event = new Event ();
+	event.item = this;
+	event.detail = SWT.ALL;
+	parent.sendEvent (expanded ? SWT.Expand : SWT.Collapse, event);
+	if (isDisposed ()) return;
+	boolean create = expanded && preload && (parent.style & SWT.VIRTUAL) != 0;
+	if (create && !parent.checkData (this)) return;
+	/*
+	* Items created later for rows of a virtual tree start collapsed, so when
+	* the items are not created up front, only the rows that have items are
+	* expanded, one level at a time, instead of all rows with open_all.
+	*/
+	boolean expandRows = expanded && !create && (parent.style & SWT.VIRTUAL) != 0;
+	if (!expandRows) {
+		parent.setSubtreeExpanded (handle, expanded, create, false);
+		if (isDisposed ()) return;
+	}
+	isExpanded = expanded;
+	/*
+	* The whole subtree is expanded by a single call with open_all set or by
+	* one walk over the rows that have items, or collapsed together with the
+	* receiver, so test-expand-row and test-collapse-row are blocked once
+	* instead of for every row.
+	*/
+	long path = GTK.gtk_tree_model_get_path (parent.modelHandle, handle);
+	if (expanded) {
+		OS.g_signal_handlers_block_matched (parent.handle, OS.G_SIGNAL_MATCH_DATA, 0, 0, 0, 0, TEST_EXPAND_ROW);
+		GTK.gtk_tree_view_expand_row (parent.handle, path, !expandRows);
+		if (expandRows) parent.setSubtreeExpanded (handle, true, false, true);
+		OS.g_signal_handlers_unblock_matched (parent.handle, OS.G_SIGNAL_MATCH_DATA, 0, 0, 0, 0, TEST_EXPAND_ROW);
+	} else if (GTK.gtk_tree_view_row_expanded (parent.handle, path)) {
+		OS.g_signal_handlers_block_matched (parent.handle, OS.G_SIGNAL_MATCH_DATA, 0, 0, 0, 0, TEST_COLLAPSE_ROW);
+		GTK.gtk_widget_realize (parent.handle);
+		GTK.gtk_tree_view_collapse_row (parent.handle, path);
+		OS.g_signal_handlers_unblock_matched (parent.handle, OS.G_SIGNAL_MATCH_DATA, 0, 0, 0, 0, TEST_COLLAPSE_ROW);
+	}
+	GTK.gtk_tree_path_free (path);
+}
 
 /**
  * Sets the font that the receiver will use to paint textual information
@@ -1293,6 +1437,7 @@ public void setFont (Font font){
 	long fontHandle = font != null ? font.handle : 0;
 	GTK.gtk_tree_store_set (parent.modelHandle, handle, Tree.FONT_COLUMN, fontHandle, -1);
 	cached = true;
+	packWidths = null;
 }
 
 /**
@@ -1334,6 +1479,7 @@ public void setFont (int index, Font font) {
 	long fontHandle  = font != null ? font.handle : 0;
 	GTK.gtk_tree_store_set (parent.modelHandle, handle, modelIndex + Tree.CELL_FONT, fontHandle, -1);
 	cached = true;
+	packWidths = null;
 
 	if (font != null) {
 		boolean customDraw = (parent.columnCount == 0)  ? parent.firstCustomDraw : parent.columns [index].customDraw;
@@ -1537,6 +1683,7 @@ public void setImage(int index, Image image) {
 			}
 			if (iWidth > currentWidth [0] || iHeight > currentHeight [0]) {
 				GTK.gtk_cell_renderer_set_fixed_size (pixbufRenderer, iWidth, iHeight);
+				parent.packGeneration++;
 				parent.pixbufSizeSet = true;
 				parent.pixbufHeight = iHeight;
 				parent.pixbufWidth = iWidth;
@@ -1568,6 +1715,7 @@ public void setImage(int index, Image image) {
 		 */
 		if (parent.pixbufWidth > Math.max(currentWidth [0], 0) || parent.pixbufHeight > Math.max(currentHeight [0], 0)) {
 			GTK.gtk_cell_renderer_set_fixed_size (pixbufRenderer, parent.pixbufWidth, parent.pixbufHeight);
+			parent.packGeneration++;
 		}
 	}
 
@@ -1581,6 +1729,7 @@ public void setImage(int index, Image image) {
 	}
 	GTK.gtk_tree_store_set(parent.modelHandle, handle, modelIndex + Tree.CELL_SURFACE, surface, -1);
 	cached = true;
+	packWidths = null;
 	updated = true;
 }
 
@@ -1679,6 +1828,7 @@ public void setText (int index, String string) {
 	int modelIndex = parent.columnCount == 0 ? Tree.FIRST_COLUMN : parent.columns [index].modelIndex;
 	GTK.gtk_tree_store_set (parent.modelHandle, handle, modelIndex + Tree.CELL_TEXT, buffer, -1);
 	cached = true;
+	packWidths = null;
 	updated = true;
 }
 
@@ -776,6 +776,17 @@ public void asyncExec (Runnable runnable) {
 	}
 }
 
+/*
+ * Runs post, which queues a message of the synchronizer posted with a
+ * priority or a key, the same way asyncExec(Runnable) queues messages.
+ */
+void postAsyncMessage (Runnable post) {
+	synchronized (Device.class) {
+		if (isDisposed ()) error (SWT.ERROR_DEVICE_DISPOSED);
+		post.run ();
+	}
+}
+
 /**
  * Executes the given runnable in the user-interface thread of this Display.
  * <ul>
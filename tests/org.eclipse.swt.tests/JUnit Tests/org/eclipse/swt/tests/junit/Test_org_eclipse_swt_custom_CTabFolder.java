@@ -29,6 +29,7 @@ import java.util.function.BiConsumer;
 
 import org.eclipse.swt.SWT;
 import org.eclipse.swt.custom.CTabFolder;
+import org.eclipse.swt.custom.CTabFolderRenderer;
 import org.eclipse.swt.custom.CTabItem;
 import org.eclipse.swt.custom.SashForm;
 import org.eclipse.swt.graphics.Color;
@@ -315,6 +316,28 @@ public void test_chevronAppearanceChanged() {
 	}
 }
 
+@Test
+public void test_tabSizesAreNotMeasuredOnSelection() {
+	createTabFolder(null, 20);
+	shell.open();
+	processEvents();
+	CTabFolderRenderer renderer = ctabFolder.getRenderer();
+	int measureCount = rendererCount(renderer, "measureCount");
+	int paintCount = rendererCount(renderer, "paintCount");
+
+	for (int i = 0; i < ctabFolder.getItemCount(); i++) {
+		ctabFolder.setSelection(i);
+		ctabFolder.update();
+		processEvents();
+	}
+	assertEquals("Tab texts measured on selection", measureCount, rendererCount(renderer, "measureCount"));
+	assertTrue("Tabs not painted on selection", rendererCount(renderer, "paintCount") > paintCount);
+
+	ctabFolder.getItem(5).setText("A longer text for CTabItem 5");
+	processEvents();
+	assertTrue("Changed tab text not measured", rendererCount(renderer, "measureCount") > measureCount);
+}
+
 @Test
 public void test_childControlOverlap() {
 	BiConsumer<Control, Integer> setTopRightAndCheckOverlap = (control, style) -> {
@@ -430,6 +453,16 @@ private void processEvents() {
 	}
 }
 
+private static int rendererCount(CTabFolderRenderer renderer, String name) {
+	try {
+		Field field = CTabFolderRenderer.class.getDeclaredField(name);
+		field.setAccessible(true);
+		return field.getInt(renderer);
+	} catch (ReflectiveOperationException e) {
+		throw new AssertionError("reflection access to " + CTabFolderRenderer.class.getName() + "." + name + " failed", e);
+	}
+}
+
 private static boolean reflection_shouldHighlight(CTabFolder partStackTabs) {
 	String shouldHighlightMethodName = "shouldHighlight";
 	Class<?> cTabFolderClass = CTabFolder.class;
@@ -26,6 +26,8 @@ import static org.junit.Assert.assertTrue;
 import static org.junit.Assert.fail;
 import static org.junit.Assume.assumeFalse;
 
+import java.io.IOException;
+import java.io.StringWriter;
 import java.time.Instant;
 import java.util.ArrayList;
 import java.util.HashMap;
@@ -734,6 +736,35 @@ public void test_copy() {
 	clipboard.dispose();
 }
 
+@Test
+public void test_copyIsNotAffectedByLaterChanges() {
+	if (SwtTestUtil.isCocoa) {
+		// TODO Fix Cocoa failure.
+		return;
+	}
+	Clipboard clipboard = new Clipboard(text.getDisplay());
+	String delimiter = SwtTestUtil.isWindowsOS ? "\r\n" : "\n";
+	text.setText("Line1\nLine2\nLine3");
+	StyleRange style = new StyleRange(6, 5, null, null);
+	style.fontStyle = SWT.BOLD;
+	text.setStyleRange(style);
+	text.setSelectionRange(2, 11);
+	text.copy();
+
+	/* The clipboard formats are written when requested, from the text and styles at the time of the copy */
+	text.setText("changed");
+	text.setStyleRange(null);
+	assertEquals("ne1" + delimiter + "Line2" + delimiter + "L", clipboard.getContents(TextTransfer.getInstance()));
+	String rtf = (String) clipboard.getContents(RTFTransfer.getInstance());
+	assertTrue(rtf, rtf.contains("\\b Line2\\b0"));
+	String html = (String) clipboard.getContents(HTMLTransfer.getInstance());
+	assertTrue(html, html.contains("font-weight:bold;'>Line2</span>"));
+
+	text.dispose();
+	assertEquals("ne1" + delimiter + "Line2" + delimiter + "L", clipboard.getContents(TextTransfer.getInstance()));
+	clipboard.dispose();
+}
+
 private static StyleRange getRangeForText(String str, String subStr) {
 	int index = str.indexOf(subStr);
 	if (index != -1) {
@@ -4814,6 +4845,46 @@ public void test_setWordWrapZ(){
 	assertEquals(":f:", 2, text.getLineCount());
 }
 
+@Test
+public void test_writeRTFAndHTML() throws IOException {
+	/* Enough lines for the output to be passed on in several chunks */
+	StringBuilder content = new StringBuilder();
+	for (int i = 0; i < 2000; i++) {
+		content.append("Line ").append(i).append(" <a & b> {c}\n");
+	}
+	text.setText(content.toString());
+	StyleRange[] styles = new StyleRange[200];
+	for (int i = 0; i < styles.length; i++) {
+		int offset = text.getOffsetAtLine(i * 10);
+		styles[i] = new StyleRange(offset, 4, null, null);
+		styles[i].fontStyle = i % 2 == 0 ? SWT.BOLD : SWT.ITALIC;
+	}
+	text.setStyleRanges(styles);
+
+	StringWriter rtf = new StringWriter();
+	long count = text.writeRTF(rtf, 0, text.getCharCount());
+	assertEquals(rtf.toString().length(), count);
+	assertTrue(rtf.toString().startsWith("{\\rtf1"));
+	assertTrue(rtf.toString().contains("{\\cf0\\b Line\\b0} 0 <a & b> \\{c\\}"));
+	assertTrue(rtf.toString().contains("{\\cf0\\i Line\\i0} 1990 <a & b> \\{c\\}"));
+	/* Only the clipboard RTF is null terminated */
+	assertTrue(rtf.toString().endsWith("\n}}"));
+
+	StringWriter html = new StringWriter();
+	count = text.writeHTML(html, 0, text.getCharCount());
+	assertEquals(html.toString().length(), count);
+	assertTrue(html.toString().contains("<span style='font-weight:bold;'>Line</span> 0 &lt;a &amp; b&gt; {c}</p>"));
+	assertTrue(html.toString().contains("<span style='font-style:italic;'>Line</span> 1990 &lt;a &amp; b&gt; {c}</p>"));
+	assertTrue(html.toString().endsWith("</div>\n</div>\n"));
+
+	html = new StringWriter();
+	text.writeHTML(html, 2, 4);
+	assertTrue(html.toString(), html.toString().contains("<p><span style='font-weight:bold;'>ne</span> 0</p>"));
+
+	assertThrows(IllegalArgumentException.class, () -> text.writeRTF(null, 0, 0));
+	assertThrows(IllegalArgumentException.class, () -> text.writeHTML(new StringWriter(), 0, text.getCharCount() + 1));
+}
+
 @Test
 public void test_showSelection() {
 	text.showSelection();
@@ -5545,8 +5616,8 @@ protected void rtfCopy() {
 	linesCalled[0] = 0;
 	text.copy();
 
-	// The listener is invoked twice for each line, once for RTF and once for HTML.
-	assertEquals("not all lines tested for RTF & HTML copy", 2 * text.getLineCount(), linesCalled[0]);
+	// The listener is invoked once for each line, when the copied styles are captured.
+	assertEquals("not all lines tested for RTF & HTML copy", text.getLineCount(), linesCalled[0]);
 
 	Clipboard clipboard = new Clipboard(text.getDisplay());
 	RTFTransfer rtfTranfer = RTFTransfer.getInstance();
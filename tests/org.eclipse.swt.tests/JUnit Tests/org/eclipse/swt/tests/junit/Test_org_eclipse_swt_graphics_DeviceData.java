@@ -1,5 +1,5 @@
 /*******************************************************************************
- * Copyright (c) 2000, 2015 IBM Corporation and others.
+ * Copyright (c) 2000, 2026 IBM Corporation and others.
  *
  * This program and the accompanying materials
  * are made available under the terms of the Eclipse Public License 2.0
@@ -14,8 +14,21 @@
  *******************************************************************************/
 package org.eclipse.swt.tests.junit;
 
+import static org.junit.Assert.assertEquals;
+import static org.junit.Assert.assertTrue;
+import static org.junit.Assert.fail;
+
+import java.io.IOException;
+import java.io.StringWriter;
+import java.util.ArrayList;
+import java.util.List;
 
 import org.eclipse.swt.graphics.DeviceData;
+import org.eclipse.swt.graphics.Image;
+import org.eclipse.swt.graphics.Region;
+import org.eclipse.swt.graphics.Resource;
+import org.eclipse.swt.internal.LeakReport;
+import org.eclipse.swt.widgets.Display;
 import org.junit.Test;
 
 /**
@@ -32,4 +45,78 @@ public void test_Constructor() {
 	data.tracking = true;
 }
 
+@Test
+public void test_leakReport() throws IOException {
+	Display display = Display.getDefault();
+	boolean tracking = display.isTracking();
+	List<Resource> leaked = new ArrayList<>();
+	display.setTracking(true);
+	try {
+		LeakReport.Snapshot before = LeakReport.Snapshot.capture(display);
+		leakRegions(display, leaked, 3);
+		leakImages(display, leaked, 2);
+		Region disposed = new Region(display);
+		LeakReport.Snapshot middle = LeakReport.Snapshot.capture(display);
+		assertEquals(before.size() + 6, middle.size());
+
+		LeakReport report = LeakReport.between(before, middle);
+		assertEquals(6, report.getCreatedCount());
+		assertEquals(0, report.getDisposedCount());
+		LeakReport.Group regions = findGroup(report, "Region", "leakRegions");
+		assertEquals(3, regions.created);
+		assertEquals(3, regions.live);
+		LeakReport.Group images = findGroup(report, "Image", "leakImages");
+		assertEquals(2, images.created);
+		/* The largest growth is reported first */
+		assertTrue(report.getGroups().indexOf(regions) < report.getGroups().indexOf(images));
+
+		disposed.dispose();
+		leaked.remove(leaked.size() - 1).dispose();
+		report = LeakReport.between(middle, LeakReport.Snapshot.capture(display));
+		assertEquals(0, report.getCreatedCount());
+		assertEquals(2, report.getDisposedCount());
+		assertEquals(1, findGroup(report, "Image", "leakImages").disposed);
+		assertEquals(1, findGroup(report, "Image", "leakImages").live);
+		assertEquals(3, findGroup(report, "Region", "leakRegions").live);
+
+		StringWriter json = new StringWriter();
+		report.writeJson(json);
+		assertTrue(json.toString(), json.toString().contains("\"disposed\": 2,"));
+		assertTrue(json.toString(), json.toString().contains("\"type\": \"Image\""));
+		StringWriter csv = new StringWriter();
+		report.writeCsv(csv);
+		String[] lines = csv.toString().split("\n");
+		assertEquals("type,site,live,created,disposed", lines[0]);
+		assertEquals(report.getGroups().size() + 1, lines.length);
+	} finally {
+		for (Resource resource : leaked) {
+			resource.dispose();
+		}
+		display.setTracking(tracking);
+	}
+}
+
+/* Deliberate leaks, each with a distinct allocation site */
+static void leakRegions(Display display, List<Resource> leaked, int count) {
+	for (int i = 0; i < count; i++) {
+		leaked.add(new Region(display));
+	}
+}
+
+static void leakImages(Display display, List<Resource> leaked, int count) {
+	for (int i = 0; i < count; i++) {
+		leaked.add(new Image(display, 4, 4));
+	}
+}
+
+static LeakReport.Group findGroup(LeakReport report, String type, String method) {
+	for (LeakReport.Group group : report.getGroups()) {
+		if (group.type.equals(type) && group.site.contains("." + method + "(")) {
+			return group;
+		}
+	}
+	fail("No group for " + type + " allocated in " + method);
+	return null;
+}
+
 }
@@ -1,5 +1,5 @@
 /*******************************************************************************
- * Copyright (c) 2000, 2017 IBM Corporation and others.
+ * Copyright (c) 2000, 2026 IBM Corporation and others.
  *
  * This program and the accompanying materials
  * are made available under the terms of the Eclipse Public License 2.0
@@ -19,12 +19,18 @@ import static org.junit.Assert.assertEquals;
 import static org.junit.Assert.assertFalse;
 import static org.junit.Assert.assertNotEquals;
 import static org.junit.Assert.assertNotNull;
+import static org.junit.Assert.assertNotSame;
+import static org.junit.Assert.assertSame;
 import static org.junit.Assert.assertTrue;
 import static org.junit.Assert.fail;
 
+import java.lang.reflect.Field;
+import java.util.function.Consumer;
+
 import org.eclipse.swt.SWT;
 import org.eclipse.swt.graphics.Font;
 import org.eclipse.swt.graphics.FontData;
+import org.eclipse.swt.graphics.Resource;
 import org.eclipse.swt.widgets.Display;
 import org.junit.Before;
 import org.junit.Test;
@@ -358,4 +364,41 @@ public void test_toString() {
 	assertNotNull(font.toString());
 }
 
+@SuppressWarnings("unchecked")
+@Test
+public void test_nonDisposeHandler_sharesStackPerCallSite() throws ReflectiveOperationException {
+	Field reporter = Resource.class.getDeclaredField("nonDisposedReporter");
+	reporter.setAccessible(true);
+	Consumer<Error> previous = (Consumer<Error>) reporter.get(null);
+	Resource.setNonDisposeHandler(error -> {});
+	Font[] fonts = new Font[4];
+	try {
+		for (int i = 0; i < 2; i++) {
+			fonts[i] = new Font(display, SwtTestUtil.testFontName, 10, SWT.NORMAL);
+		}
+		fonts[2] = new Font(display, SwtTestUtil.testFontName, 10, SWT.NORMAL);
+		fonts[3] = new Font(display, SwtTestUtil.testFontName, 10, SWT.NORMAL);
+		// Resources allocated at the same call site share their stack, resources
+		// allocated at different call sites of the same method do not
+		assertSame(allocationStack(fonts[0]), allocationStack(fonts[1]));
+		assertNotSame(allocationStack(fonts[0]), allocationStack(fonts[2]));
+		assertNotSame(allocationStack(fonts[2]), allocationStack(fonts[3]));
+	} finally {
+		for (Font font : fonts) {
+			if (font != null) font.dispose();
+		}
+		Resource.setNonDisposeHandler(previous);
+	}
+}
+
+Error allocationStack(Resource resource) throws ReflectiveOperationException {
+	Field trackerField = Resource.class.getDeclaredField("tracker");
+	trackerField.setAccessible(true);
+	Object tracker = trackerField.get(resource);
+	assertNotNull(tracker);
+	Field stackField = tracker.getClass().getDeclaredField("allocationStack");
+	stackField.setAccessible(true);
+	return (Error) stackField.get(tracker);
+}
+
 }
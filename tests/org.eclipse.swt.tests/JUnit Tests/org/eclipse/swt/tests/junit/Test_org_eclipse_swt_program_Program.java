@@ -1,5 +1,5 @@
 /*******************************************************************************
- * Copyright (c) 2000, 2016 IBM Corporation and others.
+ * Copyright (c) 2000, 2026 IBM Corporation and others.
  *
  * This program and the accompanying materials
  * are made available under the terms of the Eclipse Public License 2.0
@@ -15,10 +15,22 @@
 package org.eclipse.swt.tests.junit;
 
 import static org.eclipse.swt.tests.junit.SwtTestUtil.assertSWTProblem;
+import static org.junit.Assert.assertArrayEquals;
+import static org.junit.Assert.assertEquals;
 import static org.junit.Assert.assertNotNull;
+import static org.junit.Assert.assertNotSame;
+import static org.junit.Assert.assertNull;
+import static org.junit.Assert.assertSame;
 import static org.junit.Assert.assertTrue;
 import static org.junit.Assert.fail;
+import static org.junit.Assume.assumeTrue;
 
+import java.io.IOException;
+import java.lang.reflect.Method;
+import java.nio.file.Files;
+import java.nio.file.Path;
+import java.nio.file.attribute.FileTime;
+import java.util.Arrays;
 import java.util.HashSet;
 import java.util.Set;
 
@@ -200,4 +212,123 @@ public void test_toString() {
 	}
 }
 
+/* The GTK MIME index is read from fixture files through reflection */
+
+static final String GLOBS2 = String.join("\n",
+		"# This file was automatically generated by the update-mime-database command. DO NOT EDIT!",
+		"50:text/x-csrc:*.c",
+		"50:text/x-c++src:*.C:cs",
+		"50:application/pdf:*.pdf",
+		"50:application/x-compressed-tar:*.tar.gz",
+		"10:application/gzip:*.gz",
+		"40:text/x-log:*.log",
+		"60:text/x-syslog:*.log",
+		"50:text/x-chdr:*.[hH]",
+		"20:text/x-backup:*~",
+		"50:text/x-makefile:Makefile",
+		"50:application/x-nothing:__NOGLOBS__",
+		"");
+
+static final String GLOBS = String.join("\n",
+		"# This file was automatically generated by the update-mime-database command. DO NOT EDIT!",
+		"text/plain:*.txt",
+		"text/x-readme:*.txt",
+		"image/png:*.png",
+		"");
+
+Method loadMimeIndex, getMimeType, getMimeExtensions;
+
+Object loadMimeIndex(Path directory, Object previous) throws ReflectiveOperationException {
+	if (loadMimeIndex == null) {
+		Class<?> indexClass = Class.forName("org.eclipse.swt.program.Program$MimeIndex");
+		loadMimeIndex = indexClass.getDeclaredMethod("load", Path.class, indexClass);
+		getMimeType = indexClass.getDeclaredMethod("getMimeType", String.class);
+		getMimeExtensions = indexClass.getDeclaredMethod("getExtensions");
+		loadMimeIndex.setAccessible(true);
+		getMimeType.setAccessible(true);
+		getMimeExtensions.setAccessible(true);
+	}
+	return loadMimeIndex.invoke(null, directory, previous);
+}
+
+Path createMimeDirectory(String fileName, String contents) throws IOException {
+	Path directory = Files.createTempDirectory("swt-mime");
+	Files.write(directory.resolve(fileName), contents.getBytes("UTF-8"));
+	return directory;
+}
+
+void deleteMimeDirectory(Path directory) throws IOException {
+	for (String name : new String[] {"globs", "globs2"}) {
+		Files.deleteIfExists(directory.resolve(name));
+	}
+	Files.delete(directory);
+}
+
+@Test
+public void test_mimeIndexGlobs2() throws Exception {
+	assumeTrue("The MIME index is only used on GTK", SwtTestUtil.isGTK);
+	Path directory = createMimeDirectory("globs2", GLOBS2);
+	try {
+		Object index = loadMimeIndex(directory, null);
+		assertNotNull(index);
+		assertEquals("text/x-csrc", getMimeType.invoke(index, ".c"));
+		assertEquals("text/x-c++src", getMimeType.invoke(index, ".C"));
+		assertEquals("application/pdf", getMimeType.invoke(index, ".PDF"));
+		assertEquals("application/x-compressed-tar", getMimeType.invoke(index, ".tar.gz"));
+		assertEquals("application/gzip", getMimeType.invoke(index, ".gz"));
+		// the type with the highest weight wins
+		assertEquals("text/x-syslog", getMimeType.invoke(index, ".log"));
+		// globs other than *.ext are matched against the extension
+		assertEquals("text/x-chdr", getMimeType.invoke(index, ".h"));
+		assertEquals("text/x-chdr", getMimeType.invoke(index, ".H"));
+		assertEquals("text/x-backup", getMimeType.invoke(index, ".txt~"));
+		assertNull(getMimeType.invoke(index, ".unknown"));
+		assertNull(getMimeType.invoke(index, ".unknown"));
+
+		String[] extensions = (String[]) getMimeExtensions.invoke(index);
+		Arrays.sort(extensions);
+		assertArrayEquals(new String[] {".C", ".c", ".gz", ".log", ".pdf", ".tar.gz"}, extensions);
+	} finally {
+		deleteMimeDirectory(directory);
+	}
+}
+
+@Test
+public void test_mimeIndexGlobs() throws Exception {
+	assumeTrue("The MIME index is only used on GTK", SwtTestUtil.isGTK);
+	Path directory = createMimeDirectory("globs", GLOBS);
+	try {
+		Object index = loadMimeIndex(directory, null);
+		assertNotNull(index);
+		// without weights the first type in the file wins
+		assertEquals("text/plain", getMimeType.invoke(index, ".txt"));
+		assertEquals("image/png", getMimeType.invoke(index, ".png"));
+		assertNull(getMimeType.invoke(index, ".pdf"));
+	} finally {
+		deleteMimeDirectory(directory);
+	}
+}
+
+@Test
+public void test_mimeIndexReload() throws Exception {
+	assumeTrue("The MIME index is only used on GTK", SwtTestUtil.isGTK);
+	Path directory = createMimeDirectory("globs2", GLOBS2);
+	try {
+		Object index = loadMimeIndex(directory, null);
+		assertSame(index, loadMimeIndex(directory, index));
+
+		Path file = directory.resolve("globs2");
+		Files.write(file, (GLOBS2 + "50:image/png:*.png\n").getBytes("UTF-8"));
+		Files.setLastModifiedTime(file, FileTime.fromMillis(Files.getLastModifiedTime(file).toMillis() + 2000));
+		Object reloaded = loadMimeIndex(directory, index);
+		assertNotSame(index, reloaded);
+		assertEquals("image/png", getMimeType.invoke(reloaded, ".png"));
+
+		Files.delete(file);
+		assertNull(loadMimeIndex(directory, reloaded));
+	} finally {
+		deleteMimeDirectory(directory);
+	}
+}
+
 }
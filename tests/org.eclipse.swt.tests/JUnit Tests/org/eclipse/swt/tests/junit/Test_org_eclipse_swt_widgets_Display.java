@@ -1,5 +1,5 @@
 /*******************************************************************************
- * Copyright (c) 2000, 2021 IBM Corporation and others.
+ * Copyright (c) 2000, 2026 IBM Corporation and others.
  *
  * This program and the accompanying materials
  * are made available under the terms of the Eclipse Public License 2.0
@@ -24,6 +24,8 @@ import static org.junit.Assert.assertTrue;
 import static org.junit.Assert.fail;
 
 import java.io.IOException;
+import java.lang.reflect.Field;
+import java.lang.reflect.Method;
 import java.util.concurrent.CompletableFuture;
 import java.util.concurrent.CountDownLatch;
 import java.util.concurrent.TimeUnit;
@@ -38,6 +40,7 @@ import org.eclipse.swt.graphics.FontData;
 import org.eclipse.swt.graphics.Point;
 import org.eclipse.swt.graphics.Rectangle;
 import org.eclipse.swt.internal.DPIUtil;
+import org.eclipse.swt.internal.DispatchMonitor;
 import org.eclipse.swt.widgets.Button;
 import org.eclipse.swt.widgets.Display;
 import org.eclipse.swt.widgets.Event;
@@ -45,6 +48,7 @@ import org.eclipse.swt.widgets.Listener;
 import org.eclipse.swt.widgets.Monitor;
 import org.eclipse.swt.widgets.Shell;
 import org.eclipse.swt.widgets.Synchronizer;
+import org.eclipse.swt.widgets.Widget;
 import org.eclipse.test.Screenshots;
 import org.junit.Assume;
 import org.junit.Rule;
@@ -226,6 +230,80 @@ public void test_asyncExecLjava_lang_Runnable_dispose() {
 	}
 }
 
+@Test
+public void test_asyncExecLjava_lang_RunnableI() throws ReflectiveOperationException {
+	final Display display = new Display();
+	try {
+		Synchronizer synchronizer = display.getSynchronizer();
+		StringBuilder order = new StringBuilder();
+		synchronizer.asyncExec(() -> order.append('L'), Synchronizer.PRIORITY_LOW);
+		display.asyncExec(() -> order.append('N'));
+		synchronizer.asyncExec(() -> order.append('H'), Synchronizer.PRIORITY_HIGH);
+		assertEquals(3, synchronizer.getQueueDepth());
+		synchronizer.setTimeBudget(1000);
+		while (display.readAndDispatch()) {
+			// dispatch
+		}
+		assertEquals("HNL", order.toString());
+		assertEquals(0, synchronizer.getQueueDepth());
+		Method getStatistics = Synchronizer.class.getDeclaredMethod("getStatistics");
+		getStatistics.setAccessible(true);
+		assertTrue(((long[]) getStatistics.invoke(synchronizer))[1] >= 3);
+	} finally {
+		display.dispose();
+	}
+}
+
+@Test
+public void test_asyncExecCoalesced() {
+	final Display display = new Display();
+	try {
+		Synchronizer synchronizer = display.getSynchronizer();
+		AtomicInteger value = new AtomicInteger();
+		AtomicInteger runs = new AtomicInteger();
+		Object key = new Object();
+		for (int i = 1; i <= 10; i++) {
+			int current = i;
+			synchronizer.asyncExecCoalesced(key, () -> {
+				value.set(current);
+				runs.incrementAndGet();
+			}, Synchronizer.PRIORITY_NORMAL);
+		}
+		assertEquals(1, synchronizer.getQueueDepth());
+		while (display.readAndDispatch()) {
+			// dispatch
+		}
+		assertEquals(1, runs.get());
+		assertEquals(10, value.get());
+		synchronizer.asyncExecCoalesced(key, runs::incrementAndGet, Synchronizer.PRIORITY_NORMAL);
+		while (display.readAndDispatch()) {
+			// dispatch
+		}
+		assertEquals(2, runs.get());
+	} finally {
+		display.dispose();
+	}
+}
+
+@Test
+public void test_asyncExecLjava_lang_RunnableI_disposed() {
+	Display display = new Display();
+	Synchronizer synchronizer = display.getSynchronizer();
+	display.dispose();
+	try {
+		synchronizer.asyncExec(() -> {}, Synchronizer.PRIORITY_HIGH);
+		fail("No exception thrown for a disposed display");
+	} catch (SWTException e) {
+		assertEquals(SWT.ERROR_DEVICE_DISPOSED, e.code);
+	}
+	try {
+		synchronizer.asyncExecCoalesced(new Object(), () -> {}, Synchronizer.PRIORITY_NORMAL);
+		fail("No exception thrown for a disposed display");
+	} catch (SWTException e) {
+		assertEquals(SWT.ERROR_DEVICE_DISPOSED, e.code);
+	}
+}
+
 @Test
 public void test_beep() {
 	Display display = new Display();
@@ -243,6 +321,83 @@ public void test_close() {
 	assertTrue(display.isDisposed());
 }
 
+@Test
+public void test_dispatchMonitor() {
+	final Display display = new Display();
+	DispatchMonitor monitor = new DispatchMonitor(display.getThread(), 50);
+	monitor.install();
+	try {
+		Shell shell = new Shell(display);
+		Listener stall = e -> sleep(200);
+		Listener quick = e -> {};
+		shell.addListener(SWT.Help, stall);
+		shell.addListener(SWT.Help, quick);
+		shell.notifyListeners(SWT.Help, new Event());
+
+		DispatchMonitor.Histogram events = monitor.getEventHistogram(SWT.Help);
+		assertNotNull(events);
+		assertEquals(1, events.getCount());
+		assertTrue(events.getMax() >= TimeUnit.MILLISECONDS.toNanos(200));
+		assertTrue(events.getValueAtPercentile(50) >= TimeUnit.MILLISECONDS.toNanos(190));
+		DispatchMonitor.Histogram listener = monitor.getListenerHistograms().get(stall.getClass());
+		assertNotNull(listener);
+		assertEquals(1, listener.getCount());
+		listener = monitor.getListenerHistograms().get(quick.getClass());
+		assertNotNull(listener);
+		assertEquals(1, listener.getCount());
+
+		/* The watchdog captured the stack of the stalled listener */
+		DispatchMonitor.Stall[] stalls = monitor.getStalls();
+		assertEquals(1, stalls.length);
+		assertEquals(SWT.Help, stalls[0].eventType);
+		assertTrue(stalls[0].duration >= TimeUnit.MILLISECONDS.toNanos(50));
+		boolean found = false;
+		for (StackTraceElement element : stalls[0].stack) {
+			found |= element.getMethodName().equals("test_dispatchMonitor");
+		}
+		assertTrue(found);
+
+		/* Short dispatches and asyncExec runnables are not stalls */
+		display.asyncExec(() -> {});
+		display.asyncExec(() -> sleep(5));
+		while (display.readAndDispatch()) {
+			// dispatch
+		}
+		assertEquals(2, monitor.getAsyncExecRunHistogram().getCount());
+		assertEquals(2, monitor.getAsyncExecWaitHistogram().getCount());
+		assertEquals(1, monitor.getStallCount());
+
+		/* The signals that GTK emits on the widgets are timed as well */
+		if (SwtTestUtil.isGTK) {
+			shell.open();
+			while (display.readAndDispatch()) {
+				// dispatch
+			}
+			boolean timed = false;
+			for (int signal = 0; signal < 256; signal++) {
+				DispatchMonitor.Histogram histogram = monitor.getSignalHistogram(signal);
+				timed |= histogram != null && histogram.getCount() > 0;
+			}
+			assertTrue(timed);
+		}
+
+		monitor.reset();
+		assertEquals(0, monitor.getEventHistogram(SWT.Help).getCount());
+		assertEquals(0, monitor.getStalls().length);
+	} finally {
+		monitor.uninstall();
+		display.dispose();
+	}
+}
+
+static void sleep(long millis) {
+	try {
+		Thread.sleep(millis);
+	} catch (InterruptedException e) {
+		Thread.currentThread().interrupt();
+	}
+}
+
 @Test
 public void test_disposeExecLjava_lang_Runnable() {
 	// Also tests dispose and isDisposed
@@ -267,6 +422,40 @@ public void test_findDisplayLjava_lang_Thread() {
 	}
 }
 
+@Test
+public void test_findWidgetJ_recycledHandle() throws ReflectiveOperationException {
+	Assume.assumeTrue("The SWT_OBJECT_INDEX qdata is specific to GTK", SwtTestUtil.isGTK);
+	Display display = new Display();
+	try {
+		Shell shell = new Shell(display);
+		Button button = new Button(shell, SWT.PUSH);
+		long handle = Widget.class.getField("handle").getLong(button);
+		long shellHandle = Widget.class.getField("handle").getLong(shell);
+		assertSame(button, display.findWidget(handle));
+
+		Field quarkField = Display.class.getDeclaredField("SWT_OBJECT_INDEX");
+		quarkField.setAccessible(true);
+		int quark = quarkField.getInt(null);
+		Class<?> os = Class.forName("org.eclipse.swt.internal.gtk.OS");
+		Method getQdata = os.getMethod("g_object_get_qdata", long.class, int.class);
+		Method setQdata = os.getMethod("g_object_set_qdata", long.class, int.class, long.class);
+		long index = (Long) getQdata.invoke(null, handle, quark);
+		assertTrue(index != 0);
+
+		// a new object at the address of a freed handle carries no index
+		setQdata.invoke(null, handle, quark, 0L);
+		assertSame(shell, display.findWidget(shellHandle));
+		assertNull(display.findWidget(handle));
+
+		setQdata.invoke(null, handle, quark, index);
+		assertSame(button, display.findWidget(handle));
+		shell.dispose();
+		assertNull(display.findWidget(handle));
+	} finally {
+		display.dispose();
+	}
+}
+
 @Test
 public void test_getActiveShell() {
 	Assume.assumeFalse("Test fails on Mac: Bug 536564", SwtTestUtil.isCocoa);
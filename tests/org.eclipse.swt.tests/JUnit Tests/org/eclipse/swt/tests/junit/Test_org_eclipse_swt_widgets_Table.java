@@ -1,5 +1,5 @@
 /*******************************************************************************
- * Copyright (c) 2000, 2016 IBM Corporation and others.
+ * Copyright (c) 2000, 2026 IBM Corporation and others.
  *
  * This program and the accompanying materials
  * are made available under the terms of the Eclipse Public License 2.0
@@ -21,6 +21,7 @@ import static org.junit.Assert.assertNotNull;
 import static org.junit.Assert.assertTrue;
 import static org.junit.Assert.fail;
 
+import java.lang.reflect.Method;
 import java.util.ArrayList;
 import java.util.List;
 
@@ -625,6 +626,36 @@ public void test_getSelectionIndices() {
 	assertArrayEquals(new int[]{}, table.getSelectionIndices());
 }
 
+@Test
+public void test_indexOfAfterInsertAndRemove() throws ReflectiveOperationException {
+	List<TableItem> items = new ArrayList<>();
+	for (int i = 0; i < 1000; i++) {
+		items.add(new TableItem(table, SWT.NONE));
+	}
+	items.add(0, new TableItem(table, SWT.NONE, 0));
+	items.add(500, new TableItem(table, SWT.NONE, 500));
+	items.remove(10).dispose();
+	table.remove(20, 29);
+	items.subList(20, 30).clear();
+	table.remove(new int[] { 700, 100 });
+	items.remove(700);
+	items.remove(100);
+	long scans = SwtTestUtil.isGTK ? getIndexScanCount() : 0;
+	for (int i = items.size() - 1; i >= 0; i--) {
+		assertEquals(i, table.indexOf(items.get(i)));
+	}
+	if (SwtTestUtil.isGTK) {
+		// all stale indices are renumbered by one scan on GTK
+		assertEquals(scans + 1, getIndexScanCount());
+	}
+}
+
+private long getIndexScanCount() throws ReflectiveOperationException {
+	Method method = Table.class.getDeclaredMethod("getIndexStatistics");
+	method.setAccessible(true);
+	return (Long) method.invoke(table);
+}
+
 @Test
 public void test_indexOfLorg_eclipse_swt_widgets_TableItem() {
 	int number = 20;
@@ -1,5 +1,5 @@
 /*******************************************************************************
- * Copyright (c) 2000, 2017 IBM Corporation and others.
+ * Copyright (c) 2000, 2026 IBM Corporation and others.
  *
  * This program and the accompanying materials
  * are made available under the terms of the Eclipse Public License 2.0
@@ -26,6 +26,7 @@ import org.eclipse.swt.events.SelectionListener;
 import org.eclipse.swt.widgets.Event;
 import org.eclipse.swt.widgets.Table;
 import org.eclipse.swt.widgets.TableColumn;
+import org.eclipse.swt.widgets.TableItem;
 import org.junit.Before;
 import org.junit.Test;
 
@@ -129,6 +130,21 @@ public void test_getWidth() {
 	assertEquals(":c: width=" + tableColumn.getWidth() + " should be=" + testWidth, testWidth, tableColumn.getWidth());
 }
 
+@Test
+public void test_packWithMeasureItem() {
+	TableItem item = new TableItem(table, SWT.NONE);
+	item.setText("item");
+	int[] measuredWidth = {50};
+	table.addListener(SWT.MeasureItem, event -> event.width = measuredWidth[0]);
+	tableColumn.pack();
+	int width = tableColumn.getWidth();
+
+	// the listener can report a different width without any change to the item
+	measuredWidth[0] = 150;
+	tableColumn.pack();
+	assertTrue(":a: width=" + tableColumn.getWidth() + " should be > " + width, tableColumn.getWidth() > width);
+}
+
 @Test
 public void test_removeSelectionListenerLorg_eclipse_swt_events_SelectionListener() {
 	SelectionListener listener = new SelectionAdapter() {
@@ -1,5 +1,5 @@
 /*******************************************************************************
- * Copyright (c) 2000, 2017 IBM Corporation and others.
+ * Copyright (c) 2000, 2026 IBM Corporation and others.
  *
  * This program and the accompanying materials
  * are made available under the terms of the Eclipse Public License 2.0
@@ -21,6 +21,7 @@ import static org.junit.Assert.assertNull;
 import static org.junit.Assert.assertTrue;
 import static org.junit.Assert.fail;
 
+import java.lang.reflect.Method;
 import java.util.ArrayList;
 import java.util.List;
 
@@ -1150,6 +1151,45 @@ public void test_setItemCount_indexOf() {
 	});
 }
 
+@Test
+public void test_indexOfAfterInsertAndRemove() throws ReflectiveOperationException {
+	List<TreeItem> roots = new ArrayList<>();
+	for (int i = 0; i < 10; i++) {
+		roots.add(new TreeItem(tree, SWT.NONE));
+	}
+	TreeItem root = roots.get(5);
+	List<TreeItem> children = new ArrayList<>();
+	for (int i = 0; i < 1000; i++) {
+		children.add(new TreeItem(root, SWT.NONE));
+	}
+	children.add(0, new TreeItem(root, SWT.NONE, 0));
+	children.add(500, new TreeItem(root, SWT.NONE, 500));
+	children.remove(10).dispose();
+	roots.remove(2).dispose();
+	roots.add(0, new TreeItem(tree, SWT.NONE, 0));
+	long scans = SwtTestUtil.isGTK ? getIndexStatistics()[0] : 0;
+	for (int i = children.size() - 1; i >= 0; i--) {
+		assertEquals(i, root.indexOf(children.get(i)));
+		assertEquals(-1, tree.indexOf(children.get(i)));
+		assertEquals(root, children.get(i).getParentItem());
+	}
+	for (int i = 0; i < roots.size(); i++) {
+		assertEquals(i, tree.indexOf(roots.get(i)));
+		assertEquals(-1, root.indexOf(roots.get(i)));
+		assertNull(roots.get(i).getParentItem());
+	}
+	if (SwtTestUtil.isGTK) {
+		// the children and the roots are renumbered by one scan each on GTK
+		assertEquals(scans + 2, getIndexStatistics()[0]);
+	}
+}
+
+private long[] getIndexStatistics() throws ReflectiveOperationException {
+	Method method = Tree.class.getDeclaredMethod("getIndexStatistics");
+	method.setAccessible(true);
+	return (long[]) method.invoke(tree);
+}
+
 @Test
 public void test_setItemCount_itemCount() {
 	testTreeRegularAndVirtual(() -> {
@@ -1,5 +1,5 @@
 /*******************************************************************************
- * Copyright (c) 2000, 2018 IBM Corporation and others.
+ * Copyright (c) 2000, 2026 IBM Corporation and others.
  *
  * This program and the accompanying materials
  * are made available under the terms of the Eclipse Public License 2.0
@@ -20,6 +20,9 @@ import static org.junit.Assert.assertNull;
 import static org.junit.Assert.assertTrue;
 import static org.junit.Assert.fail;
 
+import java.util.ArrayList;
+import java.util.List;
+
 import org.eclipse.swt.SWT;
 import org.eclipse.swt.graphics.Color;
 import org.eclipse.swt.graphics.Font;
@@ -28,6 +31,7 @@ import org.eclipse.swt.graphics.Image;
 import org.eclipse.swt.graphics.Point;
 import org.eclipse.swt.graphics.Rectangle;
 import org.eclipse.swt.widgets.Display;
+import org.eclipse.swt.widgets.Event;
 import org.eclipse.swt.widgets.Tree;
 import org.eclipse.swt.widgets.TreeColumn;
 import org.eclipse.swt.widgets.TreeItem;
@@ -806,6 +810,64 @@ public void test_setExpandedZ() {
 	assertFalse(ti.getExpanded());
 }
 
+@Test
+public void test_setSubtreeExpandedZZ() {
+	List<TreeItem> folders = new ArrayList<>();
+	folders.add(treeItem);
+	for (int i = 0; i < 3; i++) {
+		TreeItem folder = new TreeItem(treeItem, SWT.NONE);
+		folders.add(folder);
+		for (int j = 0; j < 3; j++) {
+			TreeItem subfolder = new TreeItem(folder, SWT.NONE);
+			folders.add(subfolder);
+			new TreeItem(subfolder, SWT.NONE);
+		}
+	}
+	List<Event> events = new ArrayList<>();
+	tree.addListener(SWT.Expand, events::add);
+	tree.addListener(SWT.Collapse, events::add);
+
+	treeItem.setSubtreeExpanded(true, false);
+	assertEquals(1, events.size());
+	assertEquals(SWT.Expand, events.get(0).type);
+	assertEquals(treeItem, events.get(0).item);
+	assertEquals(SWT.ALL, events.get(0).detail);
+	for (TreeItem folder : folders) {
+		assertTrue(folder.getExpanded());
+	}
+
+	events.clear();
+	treeItem.setSubtreeExpanded(false, false);
+	assertEquals(1, events.size());
+	assertEquals(SWT.Collapse, events.get(0).type);
+	assertEquals(SWT.ALL, events.get(0).detail);
+	for (TreeItem folder : folders) {
+		assertFalse(folder.getExpanded());
+	}
+}
+
+@Test
+public void test_setSubtreeExpandedZZ_virtual() {
+	tree.dispose();
+	tree = new Tree(shell, SWT.VIRTUAL);
+	List<TreeItem> requested = new ArrayList<>();
+	tree.addListener(SWT.SetData, event -> {
+		TreeItem item = (TreeItem) event.item;
+		requested.add(item);
+		item.setText("Item " + event.index);
+		if (item.getParentItem() == null || item.getParentItem().getParentItem() == null) {
+			item.setItemCount(10);
+		}
+	});
+	tree.setItemCount(1);
+	TreeItem root = tree.getItem(0);
+	root.setSubtreeExpanded(true, true);
+	// the root, its 10 children and their 100 children
+	assertEquals(111, requested.size());
+	assertTrue(root.getExpanded());
+	assertTrue(root.getItem(9).getExpanded());
+}
+
 @Test
 public void test_setFontLorg_eclipse_swt_graphics_Font() {
 	Font font = treeItem.getFont();
@@ -129,6 +129,41 @@ public void test_notifyListenersILorg_eclipse_swt_widgets_Event() {
 	if (gc != null) gc.dispose();
 }
 @Test
+public void test_notifyListeners_reentrantHookUnhook() {
+	StringBuilder order = new StringBuilder();
+	Listener third = e -> order.append('3');
+	Listener fourth = e -> order.append('4');
+	Listener second = e -> order.append('2');
+	Listener first = new Listener() {
+		boolean modified;
+		@Override
+		public void handleEvent(Event e) {
+			order.append('1');
+			if (!modified) {
+				modified = true;
+				widget.removeListener(SWT.Help, second);
+				widget.addListener(SWT.Help, fourth);
+			}
+		}
+	};
+	int existing = widget.getListeners(SWT.Help).length;
+	widget.addListener(SWT.Help, first);
+	widget.addListener(SWT.Arm, e -> order.append('A'));
+	widget.addListener(SWT.Help, second);
+	widget.addListener(SWT.Help, third);
+	widget.notifyListeners(SWT.Help, new Event());
+	assertEquals("134", order.toString());
+	order.setLength(0);
+	widget.notifyListeners(SWT.Help, new Event());
+	assertEquals("134", order.toString());
+	assertEquals(existing + 3, widget.getListeners(SWT.Help).length);
+	assertTrue(widget.isListening(SWT.Arm));
+	widget.removeListener(SWT.Help, first);
+	order.setLength(0);
+	widget.notifyListeners(SWT.Help, new Event());
+	assertEquals("34", order.toString());
+}
+@Test
 public void test_removeListenerILorg_eclipse_swt_widgets_Listener() {
 	// this method is further tested by all of the removeTypedListener tests
 	try {
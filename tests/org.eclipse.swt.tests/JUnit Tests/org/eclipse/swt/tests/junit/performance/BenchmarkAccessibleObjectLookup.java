@@ -0,0 +1,104 @@
+/*******************************************************************************
+ * Copyright (c) 2026 IBM Corporation and others.
+ *
+ * This program and the accompanying materials
+ * are made available under the terms of the Eclipse Public License 2.0
+ * which accompanies this distribution, and is available at
+ * https://www.eclipse.org/legal/epl-2.0/
+ *
+ * SPDX-License-Identifier: EPL-2.0
+ *
+ * Contributors:
+ *     IBM Corporation - initial API and implementation
+ *******************************************************************************/
+package org.eclipse.swt.tests.junit.performance;
+
+import java.lang.reflect.Field;
+import java.lang.reflect.Method;
+
+import org.eclipse.swt.SWT;
+import org.eclipse.swt.accessibility.Accessible;
+import org.eclipse.swt.widgets.Button;
+import org.eclipse.swt.widgets.Composite;
+import org.eclipse.swt.widgets.Display;
+import org.eclipse.swt.widgets.Label;
+import org.eclipse.swt.widgets.Shell;
+
+/**
+ * Tests how fast the GTK accessibility bridge resolves the AccessibleObject
+ * of an AtkObject handle, which every ATK callback does first. The load
+ * simulates an assistive technology walking a widget tree and issuing a
+ * few callbacks for each object it visits. GTK only, the lookup is invoked
+ * through reflection.
+ */
+public class BenchmarkAccessibleObjectLookup {
+	private static final int[] OBJECT_COUNTS = { 100, 1_000, 10_000 };
+	private static final int CALLBACKS_PER_OBJECT = 4;
+	private static final int WALKS = 20;
+
+	/**
+	 * manual performance test
+	 *
+	 * @param args ignored
+	 */
+	public static void main(String[] args) throws ReflectiveOperationException {
+		if (!"gtk".equals(SWT.getPlatform())) {
+			System.out.println("The ATK bridge is only available on GTK");
+			return;
+		}
+		Class<?> objectClass = Class.forName("org.eclipse.swt.accessibility.AccessibleObject");
+		Method getAccessibleObject = objectClass.getDeclaredMethod("getAccessibleObject", long.class);
+		Method getStatistics = objectClass.getDeclaredMethod("getObjectTableStatistics");
+		getAccessibleObject.setAccessible(true);
+		getStatistics.setAccessible(true);
+
+		final Display display = new Display();
+		try {
+			for (int runs = 0; runs < 5; runs++) {
+				for (int objects : OBJECT_COUNTS) {
+					measure(display, objects, getAccessibleObject, getStatistics);
+				}
+			}
+		} finally {
+			display.dispose();
+		}
+	}
+
+	static void measure(Display display, int objects, Method getAccessibleObject, Method getStatistics)
+			throws ReflectiveOperationException {
+		Shell shell = new Shell(display);
+		long[] handles = new long[objects];
+		Composite composite = null;
+		for (int i = 0; i < objects; i++) {
+			if (i % 50 == 0) composite = new Composite(shell, SWT.NONE);
+			Accessible accessible = (i % 2 == 0 ? new Button(composite, SWT.PUSH) : new Label(composite, SWT.NONE)).getAccessible();
+			handles[i] = atkHandle(accessible);
+		}
+
+		long[] before = (long[]) getStatistics.invoke(null);
+		long nanoTime = System.nanoTime();
+		for (int walk = 0; walk < WALKS; walk++) {
+			for (long handle : handles) {
+				for (int i = 0; i < CALLBACKS_PER_OBJECT; i++) {
+					getAccessibleObject.invoke(null, handle);
+				}
+			}
+		}
+		long nanos = System.nanoTime() - nanoTime;
+		long[] after = (long[]) getStatistics.invoke(null);
+		long lookups = after[1] - before[1];
+		System.out.println("Objects: " + String.format("%,8d", after[0])
+				+ "  resolving: " + String.format("%,10d", nanos / Math.max(1, lookups))
+				+ " ns per callback  last object hits: " + String.format("%,10d", after[2] - before[2]));
+		shell.dispose();
+	}
+
+	static long atkHandle(Accessible accessible) throws ReflectiveOperationException {
+		Field objectField = Accessible.class.getDeclaredField("accessibleObject");
+		objectField.setAccessible(true);
+		Object object = objectField.get(accessible);
+		Field handleField = object.getClass().getDeclaredField("atkHandle");
+		handleField.setAccessible(true);
+		return handleField.getLong(object);
+	}
+}
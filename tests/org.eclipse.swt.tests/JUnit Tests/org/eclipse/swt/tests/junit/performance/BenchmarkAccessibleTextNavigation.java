@@ -0,0 +1,112 @@
+/*******************************************************************************
+ * Copyright (c) 2026 IBM Corporation and others.
+ *
+ * This program and the accompanying materials
+ * are made available under the terms of the Eclipse Public License 2.0
+ * which accompanies this distribution, and is available at
+ * https://www.eclipse.org/legal/epl-2.0/
+ *
+ * SPDX-License-Identifier: EPL-2.0
+ *
+ * Contributors:
+ *     IBM Corporation - initial API and implementation
+ *******************************************************************************/
+package org.eclipse.swt.tests.junit.performance;
+
+import java.lang.reflect.Field;
+import java.lang.reflect.Method;
+
+import org.eclipse.swt.SWT;
+import org.eclipse.swt.accessibility.ACC;
+import org.eclipse.swt.accessibility.Accessible;
+import org.eclipse.swt.accessibility.AccessibleControlAdapter;
+import org.eclipse.swt.accessibility.AccessibleControlEvent;
+import org.eclipse.swt.accessibility.AccessibleTextAdapter;
+import org.eclipse.swt.widgets.Canvas;
+import org.eclipse.swt.widgets.Display;
+import org.eclipse.swt.widgets.Shell;
+
+/**
+ * Tests the GTK accessibility bridge while an assistive technology steps
+ * through the value of a large custom text control one character at a
+ * time, asking for the character count and the character at the caret on
+ * every step, as a screen reader does. Every hundredth step optionally
+ * edits the text and reports the change. GTK only, the ATK callbacks are
+ * invoked through reflection.
+ */
+public class BenchmarkAccessibleTextNavigation {
+	private static final int[] LINE_COUNTS = { 1_000, 10_000, 100_000 };
+	private static final int STEPS = 2_000;
+	private static final String LINE = "The quick brown fox jumps over the lazy dog 0123456789\n";
+
+	static StringBuilder document = new StringBuilder();
+
+	/**
+	 * manual performance test
+	 *
+	 * @param args ignored
+	 */
+	public static void main(String[] args) throws ReflectiveOperationException {
+		if (!"gtk".equals(SWT.getPlatform())) {
+			System.out.println("The ATK bridge is only available on GTK");
+			return;
+		}
+		Class<?> objectClass = Class.forName("org.eclipse.swt.accessibility.AccessibleObject");
+		Method getCharacterCount = objectClass.getDeclaredMethod("atkText_get_character_count", long.class);
+		Method getCharacterAtOffset = objectClass.getDeclaredMethod("atkText_get_character_at_offset", long.class, long.class);
+		getCharacterCount.setAccessible(true);
+		getCharacterAtOffset.setAccessible(true);
+
+		final Display display = new Display();
+		try {
+			Shell shell = new Shell(display);
+			Canvas canvas = new Canvas(shell, SWT.NONE);
+			Accessible accessible = canvas.getAccessible();
+			accessible.addAccessibleControlListener(new AccessibleControlAdapter() {
+				@Override
+				public void getValue(AccessibleControlEvent e) {
+					e.result = document.toString();
+				}
+			});
+			accessible.addAccessibleTextListener(new AccessibleTextAdapter());
+			long atkHandle = atkHandle(accessible);
+			for (int runs = 0; runs < 5; runs++) {
+				for (int lines : LINE_COUNTS) {
+					document.setLength(0);
+					document.append(LINE.repeat(lines));
+					accessible.textChanged(ACC.TEXT_INSERT, 0, document.length());
+					long readNanos = navigate(accessible, atkHandle, getCharacterCount, getCharacterAtOffset, false);
+					long editNanos = navigate(accessible, atkHandle, getCharacterCount, getCharacterAtOffset, true);
+					System.out.println("Lines: " + String.format("%,10d", lines)
+							+ "  reading: " + String.format("%,15d", readNanos / STEPS)
+							+ " ns per step  editing: " + String.format("%,15d", editNanos / STEPS) + " ns per step");
+				}
+			}
+		} finally {
+			display.dispose();
+		}
+	}
+
+	static long navigate(Accessible accessible, long atkHandle, Method getCharacterCount, Method getCharacterAtOffset, boolean edit)
+			throws ReflectiveOperationException {
+		long nanoTime = System.nanoTime();
+		for (int offset = 0; offset < STEPS; offset++) {
+			if (edit && offset % 100 == 0) {
+				document.insert(offset, 'x');
+				accessible.textChanged(ACC.TEXT_INSERT, offset, 1);
+			}
+			getCharacterCount.invoke(null, atkHandle);
+			getCharacterAtOffset.invoke(null, atkHandle, (long) offset);
+		}
+		return System.nanoTime() - nanoTime;
+	}
+
+	static long atkHandle(Accessible accessible) throws ReflectiveOperationException {
+		Field objectField = Accessible.class.getDeclaredField("accessibleObject");
+		objectField.setAccessible(true);
+		Object object = objectField.get(accessible);
+		Field handleField = object.getClass().getDeclaredField("atkHandle");
+		handleField.setAccessible(true);
+		return handleField.getLong(object);
+	}
+}
@@ -0,0 +1,103 @@
+/*******************************************************************************
+ * Copyright (c) 2026 IBM Corporation and others.
+ *
+ * This program and the accompanying materials
+ * are made available under the terms of the Eclipse Public License 2.0
+ * which accompanies this distribution, and is available at
+ * https://www.eclipse.org/legal/epl-2.0/
+ *
+ * SPDX-License-Identifier: EPL-2.0
+ *
+ * Contributors:
+ *     IBM Corporation - initial API and implementation
+ *******************************************************************************/
+package org.eclipse.swt.tests.junit.performance;
+
+import java.lang.reflect.Method;
+import java.util.concurrent.atomic.AtomicInteger;
+
+import org.eclipse.swt.widgets.Display;
+import org.eclipse.swt.widgets.Synchronizer;
+
+/**
+ * Floods the asyncExec queue and measures how long events dispatched by the
+ * native event loop (simulated by timers) wait while the queue is drained with
+ * different time budgets.
+ */
+public class BenchmarkAsyncExecDrain {
+	private static final int FLOOD_SIZE = 1_000_000;
+	private static final int PROBES = 200;
+	private static final int[] BUDGETS = { 0, 1, 5, 20 };
+	static AtomicInteger countdown = new AtomicInteger();
+
+	/**
+	 * manual performance test
+	 *
+	 * @param args ignored
+	 * @throws Exception
+	 */
+	public static void main(String[] args) throws Exception {
+		final Display display = new Display();
+		try {
+			Synchronizer synchronizer = display.getSynchronizer();
+			Method getStatistics = Synchronizer.class.getDeclaredMethod("getStatistics");
+			getStatistics.setAccessible(true);
+			Method resetStatistics = Synchronizer.class.getDeclaredMethod("resetStatistics");
+			resetStatistics.setAccessible(true);
+			for (int runs = 0; runs < 10; runs++) {
+				for (int budget : BUDGETS) {
+					synchronizer.setTimeBudget(budget);
+					resetStatistics.invoke(synchronizer);
+					countdown.set(FLOOD_SIZE);
+					Thread producer = new Thread(() -> {
+						for (int i = 0; i < FLOOD_SIZE; i++) {
+							display.asyncExec(() -> countdown.decrementAndGet());
+						}
+					}, "producer");
+					producer.start();
+
+					long[] probeLatency = new long[1];
+					long[] probeMax = new long[1];
+					int[] probeCount = new int[1];
+					long[] priorityLatency = new long[1];
+					Runnable[] probe = new Runnable[1];
+					probe[0] = () -> {
+						probeCount[0]++;
+						if (probeCount[0] < PROBES && countdown.get() > 0) {
+							long scheduled = System.nanoTime();
+							display.timerExec(0, () -> {
+								long latency = System.nanoTime() - scheduled;
+								probeLatency[0] += latency;
+								probeMax[0] = Math.max(probeMax[0], latency);
+								probe[0].run();
+							});
+						}
+					};
+					probe[0].run();
+					long scheduled = System.nanoTime();
+					synchronizer.asyncExec(() -> priorityLatency[0] = System.nanoTime() - scheduled,
+							Synchronizer.PRIORITY_HIGH);
+
+					long nanoTime = System.nanoTime();
+					while (countdown.get() > 0 || producer.isAlive()) {
+						if (!display.readAndDispatch())
+							display.sleep();
+					}
+					long durationNanos = System.nanoTime() - nanoTime;
+					producer.join();
+
+					long[] statistics = (long[]) getStatistics.invoke(synchronizer);
+					System.out.println("Budget: " + String.format("%2d", budget) + " ms"
+							+ "  handling: " + String.format("%,15d", durationNanos) + " ns"
+							+ "  input avg: " + String.format("%,12d", probeLatency[0] / Math.max(1, probeCount[0] - 1)) + " ns"
+							+ "  input max: " + String.format("%,12d", probeMax[0]) + " ns"
+							+ "  high priority: " + String.format("%,12d", priorityLatency[0]) + " ns"
+							+ "  max depth: " + String.format("%,10d", statistics[0])
+							+ "  max wait: " + String.format("%,15d", statistics[3]) + " ns");
+				}
+			}
+		} finally {
+			display.dispose();
+		}
+	}
+}
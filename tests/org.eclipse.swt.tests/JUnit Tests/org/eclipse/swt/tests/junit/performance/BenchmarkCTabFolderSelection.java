@@ -0,0 +1,96 @@
+/*******************************************************************************
+ * Copyright (c) 2026 IBM Corporation and others.
+ *
+ * This program and the accompanying materials
+ * are made available under the terms of the Eclipse Public License 2.0
+ * which accompanies this distribution, and is available at
+ * https://www.eclipse.org/legal/epl-2.0/
+ *
+ * SPDX-License-Identifier: EPL-2.0
+ *
+ * Contributors:
+ *     IBM Corporation - initial API and implementation
+ *******************************************************************************/
+package org.eclipse.swt.tests.junit.performance;
+
+import java.lang.reflect.Field;
+
+import org.eclipse.swt.SWT;
+import org.eclipse.swt.custom.CTabFolder;
+import org.eclipse.swt.custom.CTabFolderRenderer;
+import org.eclipse.swt.custom.CTabItem;
+import org.eclipse.swt.layout.FillLayout;
+import org.eclipse.swt.widgets.Display;
+import org.eclipse.swt.widgets.Shell;
+
+/**
+ * Tests cycling the selection across the tabs of a CTabFolder, as in an
+ * editor stack with many open editors, and reports how many tab texts were
+ * measured and how many tabs were painted.
+ */
+public class BenchmarkCTabFolderSelection {
+	private static final int[] TAB_COUNTS = { 10, 50, 200 };
+	private static final int CYCLES = 5;
+
+	/**
+	 * manual performance test
+	 *
+	 * @param args ignored
+	 */
+	public static void main(String[] args) throws ReflectiveOperationException {
+		final Display display = new Display();
+		try {
+			for (int runs = 0; runs < 5; runs++) {
+				for (int tabs : TAB_COUNTS) {
+					measure(display, tabs);
+				}
+			}
+		} finally {
+			display.dispose();
+		}
+	}
+
+	static void measure(Display display, int tabs) throws ReflectiveOperationException {
+		Shell shell = new Shell(display);
+		shell.setLayout(new FillLayout());
+		CTabFolder folder = new CTabFolder(shell, SWT.BORDER | SWT.CLOSE);
+		for (int i = 0; i < tabs; i++) {
+			CTabItem item = new CTabItem(folder, SWT.NONE);
+			item.setText("Editor" + i + ".java");
+		}
+		folder.setSelection(0);
+		shell.setSize(1200, 400);
+		shell.open();
+		flush(display, folder);
+
+		CTabFolderRenderer renderer = folder.getRenderer();
+		int measureCount = count(renderer, "measureCount");
+		int paintCount = count(renderer, "paintCount");
+		long nanoTime = System.nanoTime();
+		for (int cycle = 0; cycle < CYCLES; cycle++) {
+			for (int i = 0; i < tabs; i++) {
+				folder.setSelection(i);
+				flush(display, folder);
+			}
+		}
+		long nanos = System.nanoTime() - nanoTime;
+		int selections = CYCLES * tabs;
+		System.out.println("Tabs: " + String.format("%,6d", tabs)
+				+ "  selecting: " + String.format("%,15d", nanos / selections)
+				+ " ns per selection  measured: " + String.format("%,8d", count(renderer, "measureCount") - measureCount)
+				+ "  painted: " + String.format("%,8d", count(renderer, "paintCount") - paintCount));
+		shell.dispose();
+	}
+
+	static void flush(Display display, CTabFolder folder) {
+		while (display.readAndDispatch()) {
+		}
+		folder.update();
+	}
+
+	static int count(CTabFolderRenderer renderer, String name) throws ReflectiveOperationException {
+		Field field = CTabFolderRenderer.class.getDeclaredField(name);
+		field.setAccessible(true);
+		return field.getInt(renderer);
+	}
+}
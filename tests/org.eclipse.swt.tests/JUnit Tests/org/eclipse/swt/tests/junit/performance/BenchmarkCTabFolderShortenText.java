@@ -0,0 +1,75 @@
+/*******************************************************************************
+ * Copyright (c) 2026 IBM Corporation and others.
+ *
+ * This program and the accompanying materials
+ * are made available under the terms of the Eclipse Public License 2.0
+ * which accompanies this distribution, and is available at
+ * https://www.eclipse.org/legal/epl-2.0/
+ *
+ * SPDX-License-Identifier: EPL-2.0
+ *
+ * Contributors:
+ *     IBM Corporation - initial API and implementation
+ *******************************************************************************/
+package org.eclipse.swt.tests.junit.performance;
+
+import org.eclipse.swt.SWT;
+import org.eclipse.swt.custom.CTabFolder;
+import org.eclipse.swt.custom.CTabItem;
+import org.eclipse.swt.layout.FillLayout;
+import org.eclipse.swt.widgets.Display;
+import org.eclipse.swt.widgets.Shell;
+
+/**
+ * Tests laying out and painting a narrow CTabFolder with hundreds of tabs
+ * whose long titles have to be shortened with an ellipsis.
+ */
+public class BenchmarkCTabFolderShortenText {
+	private static final int TAB_COUNT = 500;
+	private static final int RESIZES = 200;
+	private static final String TITLE = "A rather long editor title that does not fit into its tab ";
+
+	/**
+	 * manual performance test
+	 *
+	 * @param args ignored
+	 */
+	public static void main(String[] args) {
+		final Display display = new Display();
+		try {
+			Shell shell = new Shell(display);
+			shell.setLayout(new FillLayout());
+			CTabFolder folder = new CTabFolder(shell, SWT.BORDER);
+			folder.setMinimumCharacters(10);
+			for (int i = 0; i < TAB_COUNT; i++) {
+				CTabItem item = new CTabItem(folder, SWT.CLOSE);
+				item.setText(TITLE + i);
+			}
+			folder.setSelection(0);
+			shell.setSize(600, 300);
+			shell.open();
+			for (int runs = 0; runs < 10; runs++) {
+				measure(display, shell, folder, false);
+				measure(display, shell, folder, true);
+			}
+		} finally {
+			display.dispose();
+		}
+	}
+
+	static void measure(Display display, Shell shell, CTabFolder folder, boolean simple) {
+		folder.setSimple(simple);
+		long nanoTime = System.nanoTime();
+		for (int i = 0; i < RESIZES; i++) {
+			shell.setSize(400 + (i % 20) * 20, 300);
+			folder.redraw();
+			folder.update();
+			while (display.readAndDispatch()) {
+			}
+		}
+		long nanos = System.nanoTime() - nanoTime;
+		System.out.println("Tabs: " + String.format("%,6d", folder.getItemCount())
+				+ "  simple: " + String.format("%-5s", simple)
+				+ "  resizing: " + String.format("%,15d", nanos / RESIZES) + " ns per resize");
+	}
+}
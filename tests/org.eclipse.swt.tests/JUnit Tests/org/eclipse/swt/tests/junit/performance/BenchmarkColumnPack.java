@@ -0,0 +1,138 @@
+/*******************************************************************************
+ * Copyright (c) 2026 IBM Corporation and others.
+ *
+ * This program and the accompanying materials
+ * are made available under the terms of the Eclipse Public License 2.0
+ * which accompanies this distribution, and is available at
+ * https://www.eclipse.org/legal/epl-2.0/
+ *
+ * SPDX-License-Identifier: EPL-2.0
+ *
+ * Contributors:
+ *     IBM Corporation - initial API and implementation
+ *******************************************************************************/
+package org.eclipse.swt.tests.junit.performance;
+
+import org.eclipse.swt.SWT;
+import org.eclipse.swt.layout.FillLayout;
+import org.eclipse.swt.widgets.Display;
+import org.eclipse.swt.widgets.Shell;
+import org.eclipse.swt.widgets.Table;
+import org.eclipse.swt.widgets.TableColumn;
+import org.eclipse.swt.widgets.TableItem;
+import org.eclipse.swt.widgets.Tree;
+import org.eclipse.swt.widgets.TreeColumn;
+import org.eclipse.swt.widgets.TreeItem;
+
+/**
+ * Tests packing a column of a large table and of a large tree. The column
+ * is packed once, again without changes, and again after a hundred rows
+ * changed, with all rows measured and with a sample of a thousand rows.
+ * The sample size is an internal GTK setting and is ignored elsewhere.
+ */
+public class BenchmarkColumnPack {
+	private static final int[] ROW_COUNTS = { 10_000, 100_000, 500_000 };
+	private static final int[] SAMPLE_SIZES = { 0, 1_000 };
+	private static final int CHANGED_ROWS = 100;
+	private static final String PACK_SAMPLE_SIZE_KEY = "org.eclipse.swt.internal.gtk.packSampleSize";
+
+	/**
+	 * manual performance test
+	 *
+	 * @param args ignored
+	 */
+	public static void main(String[] args) {
+		final Display display = new Display();
+		try {
+			for (int runs = 0; runs < 3; runs++) {
+				for (int rows : ROW_COUNTS) {
+					for (int sampleSize : SAMPLE_SIZES) {
+						packTable(display, rows, sampleSize);
+						packTree(display, rows, sampleSize);
+					}
+				}
+			}
+		} finally {
+			display.dispose();
+		}
+	}
+
+	static void packTable(Display display, int rows, int sampleSize) {
+		Shell shell = new Shell(display);
+		shell.setLayout(new FillLayout());
+		Table table = new Table(shell, SWT.BORDER);
+		table.setData(PACK_SAMPLE_SIZE_KEY, sampleSize);
+		TableColumn column = new TableColumn(table, SWT.NONE);
+		column.setText("Name");
+		for (int i = 0; i < rows; i++) {
+			new TableItem(table, SWT.NONE).setText(text(i));
+		}
+		shell.setSize(400, 600);
+		shell.open();
+		while (display.readAndDispatch()) {
+		}
+
+		long first = time(column::pack);
+		long second = time(column::pack);
+		for (int i = 0; i < CHANGED_ROWS; i++) {
+			table.getItem(i * (rows / CHANGED_ROWS)).setText(text(i) + " changed");
+		}
+		long changed = time(column::pack);
+		report("Table", rows, sampleSize, first, second, changed, column.getWidth());
+		shell.dispose();
+	}
+
+	static void packTree(Display display, int rows, int sampleSize) {
+		Shell shell = new Shell(display);
+		shell.setLayout(new FillLayout());
+		Tree tree = new Tree(shell, SWT.BORDER);
+		tree.setData(PACK_SAMPLE_SIZE_KEY, sampleSize);
+		TreeColumn column = new TreeColumn(tree, SWT.NONE);
+		column.setText("Name");
+		TreeItem[] children = new TreeItem[rows];
+		for (int i = 0; i < rows / 10; i++) {
+			TreeItem folder = new TreeItem(tree, SWT.NONE);
+			folder.setText(text(i));
+			for (int j = 0; j < 9; j++) {
+				children[i * 9 + j] = new TreeItem(folder, SWT.NONE);
+				children[i * 9 + j].setText(text(i * 9 + j));
+			}
+			folder.setExpanded(true);
+		}
+		shell.setSize(400, 600);
+		shell.open();
+		while (display.readAndDispatch()) {
+		}
+
+		long first = time(column::pack);
+		long second = time(column::pack);
+		int childCount = rows / 10 * 9;
+		for (int i = 0; i < CHANGED_ROWS; i++) {
+			TreeItem item = children[i * (childCount / CHANGED_ROWS)];
+			item.setText(item.getText() + " changed");
+		}
+		long changed = time(column::pack);
+		report("Tree", rows, sampleSize, first, second, changed, column.getWidth());
+		shell.dispose();
+	}
+
+	static String text(int i) {
+		return "Item " + i + (i % 1_000 == 0 ? " with a much longer name than the others" : "");
+	}
+
+	static long time(Runnable runnable) {
+		long nanoTime = System.nanoTime();
+		runnable.run();
+		return System.nanoTime() - nanoTime;
+	}
+
+	static void report(String name, int rows, int sampleSize, long first, long second, long changed, int width) {
+		System.out.println(String.format("%-6s", name)
+				+ "  rows: " + String.format("%,8d", rows)
+				+ "  sample: " + String.format("%,6d", sampleSize)
+				+ "  first pack: " + String.format("%,15d", first) + " ns"
+				+ "  unchanged: " + String.format("%,15d", second) + " ns"
+				+ "  " + CHANGED_ROWS + " rows changed: " + String.format("%,15d", changed) + " ns"
+				+ "  width: " + String.format("%5d", width));
+	}
+}
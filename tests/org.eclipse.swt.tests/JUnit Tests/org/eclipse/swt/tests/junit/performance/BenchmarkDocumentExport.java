@@ -0,0 +1,172 @@
+/*******************************************************************************
+ * Copyright (c) 2026 IBM Corporation and others.
+ *
+ * This program and the accompanying materials
+ * are made available under the terms of the Eclipse Public License 2.0
+ * which accompanies this distribution, and is available at
+ * https://www.eclipse.org/legal/epl-2.0/
+ *
+ * SPDX-License-Identifier: EPL-2.0
+ *
+ * Contributors:
+ *     IBM Corporation - initial API and implementation
+ *******************************************************************************/
+package org.eclipse.swt.tests.junit.performance;
+
+import java.io.File;
+import java.io.IOException;
+import java.io.OutputStream;
+import java.lang.reflect.Method;
+import java.nio.file.Files;
+import java.nio.file.Paths;
+
+import org.eclipse.swt.SWT;
+import org.eclipse.swt.graphics.Device;
+import org.eclipse.swt.graphics.GC;
+import org.eclipse.swt.graphics.Rectangle;
+import org.eclipse.swt.printing.Printer;
+import org.eclipse.swt.printing.PrinterData;
+
+/**
+ * Tests exporting a thousand page report as PDF and PostScript, and
+ * reports the time and the growth of the resident memory of the process.
+ * The report is written to a stream that counts and discards the output
+ * by the GTK DocumentExporter, and to a file by a Printer printing to a
+ * file through the GTK print backend when one is available. GTK only,
+ * the exporter is created through reflection.
+ */
+public class BenchmarkDocumentExport {
+	private static final int PAGES = 1_000;
+	private static final int LINES_PER_PAGE = 60;
+	private static final int PDF = 1;
+	private static final int POSTSCRIPT = 2;
+
+	static class CountingStream extends OutputStream {
+		long count;
+
+		@Override
+		public void write(int b) {
+			count++;
+		}
+
+		@Override
+		public void write(byte[] b, int off, int len) {
+			count += len;
+		}
+	}
+
+	/**
+	 * manual performance test
+	 *
+	 * @param args ignored
+	 */
+	public static void main(String[] args) throws ReflectiveOperationException, IOException {
+		if (!"gtk".equals(SWT.getPlatform())) {
+			System.out.println("The document exporter is only available on GTK");
+			return;
+		}
+		Class<?> exporterClass = Class.forName("org.eclipse.swt.printing.DocumentExporter");
+		for (int runs = 0; runs < 3; runs++) {
+			export(exporterClass, PDF, "PDF");
+			export(exporterClass, POSTSCRIPT, "PostScript");
+			print();
+		}
+	}
+
+	static void export(Class<?> exporterClass, int format, String name) throws ReflectiveOperationException {
+		CountingStream stream = new CountingStream();
+		Device exporter = (Device) exporterClass.getConstructor(OutputStream.class, int.class, double.class, double.class)
+				.newInstance(stream, format, 595.0, 842.0);
+		Method startPage = exporterClass.getMethod("startPage");
+		Method endPage = exporterClass.getMethod("endPage");
+		Method finish = exporterClass.getMethod("finish");
+		try {
+			long rss = residentMemory(), peak = rss;
+			long nanoTime = System.nanoTime();
+			GC gc = new GC(exporter);
+			for (int page = 0; page < PAGES; page++) {
+				startPage.invoke(exporter);
+				drawPage(gc, exporter.getClientArea(), page);
+				endPage.invoke(exporter);
+				if (page % 100 == 0) peak = Math.max(peak, residentMemory());
+			}
+			gc.dispose();
+			finish.invoke(exporter);
+			long nanos = System.nanoTime() - nanoTime;
+			peak = Math.max(peak, residentMemory());
+			report("Exporting " + name, nanos, stream.count, peak - rss);
+		} finally {
+			exporter.dispose();
+		}
+	}
+
+	static void print() throws IOException {
+		File file = File.createTempFile("BenchmarkDocumentExport", ".pdf");
+		try {
+			PrinterData data = new PrinterData();
+			data.printToFile = true;
+			data.fileName = file.getAbsolutePath();
+			Printer printer;
+			try {
+				printer = new Printer(data);
+			} catch (Throwable e) {
+				System.out.println("Printing to a file is not available: " + e);
+				return;
+			}
+			try {
+				long rss = residentMemory(), peak = rss;
+				long nanoTime = System.nanoTime();
+				if (!printer.startJob("BenchmarkDocumentExport")) return;
+				GC gc = new GC(printer);
+				for (int page = 0; page < PAGES; page++) {
+					printer.startPage();
+					drawPage(gc, printer.getClientArea(), page);
+					printer.endPage();
+					if (page % 100 == 0) peak = Math.max(peak, residentMemory());
+				}
+				gc.dispose();
+				printer.endJob();
+				long nanos = System.nanoTime() - nanoTime;
+				peak = Math.max(peak, residentMemory());
+				report("Printing to a file", nanos, file.length(), peak - rss);
+			} finally {
+				printer.dispose();
+			}
+		} finally {
+			file.delete();
+		}
+	}
+
+	static void drawPage(GC gc, Rectangle area, int page) {
+		int lineHeight = gc.getFontMetrics().getHeight();
+		int y = 0;
+		gc.drawText("Page " + (page + 1), 0, y);
+		gc.drawLine(0, lineHeight, area.width, lineHeight);
+		for (int line = 0; line < LINES_PER_PAGE && y < area.height; line++) {
+			y = (line + 2) * lineHeight;
+			gc.drawText("Item " + (page * LINES_PER_PAGE + line), 0, y);
+			gc.drawText(String.format("%,12d", (long) page * line * 1_000), area.width / 2, y);
+		}
+	}
+
+	static void report(String name, long nanos, long bytes, long memory) {
+		System.out.println(String.format("%-20s", name)
+				+ "  pages: " + String.format("%,8d", PAGES)
+				+ "  time: " + String.format("%,15d", nanos / PAGES) + " ns per page"
+				+ "  output: " + String.format("%,12d", bytes) + " bytes"
+				+ "  resident memory growth: " + String.format("%,12d", memory) + " bytes");
+	}
+
+	/** Returns the resident memory of the process in bytes, or 0 if unknown */
+	static long residentMemory() {
+		try {
+			for (String line : Files.readAllLines(Paths.get("/proc/self/status"))) {
+				if (line.startsWith("VmRSS:")) {
+					return Long.parseLong(line.replaceAll("[^0-9]", "")) * 1024;
+				}
+			}
+		} catch (IOException | NumberFormatException e) {
+		}
+		return 0;
+	}
+}
@@ -0,0 +1,140 @@
+/*******************************************************************************
+ * Copyright (c) 2026 IBM Corporation and others.
+ *
+ * This program and the accompanying materials
+ * are made available under the terms of the Eclipse Public License 2.0
+ * which accompanies this distribution, and is available at
+ * https://www.eclipse.org/legal/epl-2.0/
+ *
+ * SPDX-License-Identifier: EPL-2.0
+ *
+ * Contributors:
+ *     IBM Corporation - initial API and implementation
+ *******************************************************************************/
+package org.eclipse.swt.tests.junit.performance;
+
+import java.lang.reflect.Constructor;
+import java.lang.reflect.Method;
+
+import org.eclipse.swt.SWT;
+import org.eclipse.swt.dnd.DND;
+import org.eclipse.swt.dnd.DropTarget;
+import org.eclipse.swt.dnd.DropTargetAdapter;
+import org.eclipse.swt.dnd.DropTargetEvent;
+import org.eclipse.swt.dnd.TextTransfer;
+import org.eclipse.swt.dnd.Transfer;
+import org.eclipse.swt.dnd.TransferData;
+import org.eclipse.swt.layout.FillLayout;
+import org.eclipse.swt.widgets.Display;
+import org.eclipse.swt.widgets.Shell;
+import org.eclipse.swt.widgets.Tree;
+import org.eclipse.swt.widgets.TreeItem;
+
+/**
+ * Tests a drag moving over a large tree, as when dragging files onto a
+ * folder in a file tree. Synthetic pointer motions sweep over the visible
+ * rows, and the drop target reports how many drag over events were sent and
+ * how many items were looked up, with and without coalescing. GTK only, the
+ * motions are injected through reflection since no real drag is running.
+ */
+public class BenchmarkDropTargetMotion {
+	private static final int[] ITEM_COUNTS = { 1_000, 10_000, 100_000 };
+	private static final int[] COALESCING = { 0, 16, 50 };
+	private static final int SWEEPS = 10;
+	private static final int MOTION_INTERVAL = 4;
+	private static final String DRAGOVER_COALESCING_KEY = "org.eclipse.swt.internal.gtk.dragOverCoalescing";
+
+	static Method setEventData, dragMotion, dragLeave, getStatistics;
+	static Constructor<?> newEvent;
+
+	/**
+	 * manual performance test
+	 *
+	 * @param args ignored
+	 */
+	public static void main(String[] args) throws ReflectiveOperationException {
+		if (!"gtk".equals(SWT.getPlatform())) {
+			System.out.println("Drag motions can only be injected on GTK");
+			return;
+		}
+		Class<?> eventClass = Class.forName("org.eclipse.swt.dnd.DNDEvent");
+		newEvent = eventClass.getDeclaredConstructor();
+		setEventData = DropTarget.class.getDeclaredMethod("setEventData", int.class, int.class, int.class, int.class,
+				int.class, TransferData[].class, eventClass, boolean.class);
+		dragMotion = DropTarget.class.getDeclaredMethod("dragMotion", eventClass, int.class, int.class, int.class);
+		dragLeave = DropTarget.class.getDeclaredMethod("drag_leave", long.class, long.class, int.class);
+		getStatistics = DropTarget.class.getDeclaredMethod("getDragOverStatistics");
+		for (Method method : new Method[] { setEventData, dragMotion, dragLeave, getStatistics }) {
+			method.setAccessible(true);
+		}
+		newEvent.setAccessible(true);
+
+		final Display display = new Display();
+		try {
+			for (int runs = 0; runs < 3; runs++) {
+				for (int items : ITEM_COUNTS) {
+					for (int coalescing : COALESCING) {
+						measure(display, items, coalescing);
+					}
+				}
+			}
+		} finally {
+			display.dispose();
+		}
+	}
+
+	static void measure(Display display, int items, int coalescing) throws ReflectiveOperationException {
+		Shell shell = new Shell(display);
+		shell.setLayout(new FillLayout());
+		Tree tree = new Tree(shell, SWT.BORDER);
+		for (int i = 0; i < items / 10; i++) {
+			TreeItem folder = new TreeItem(tree, SWT.NONE);
+			folder.setText("Folder " + i);
+			for (int j = 0; j < 9; j++) {
+				new TreeItem(folder, SWT.NONE).setText("File " + i + "." + j);
+			}
+			if (i % 2 == 0) folder.setExpanded(true);
+		}
+		DropTarget target = new DropTarget(tree, DND.DROP_MOVE | DND.DROP_COPY);
+		target.setTransfer(new Transfer[] { TextTransfer.getInstance() });
+		target.addDropListener(new DropTargetAdapter() {
+			@Override
+			public void dragOver(DropTargetEvent event) {
+				event.feedback = DND.FEEDBACK_SELECT | DND.FEEDBACK_SCROLL;
+			}
+		});
+		target.setData(DRAGOVER_COALESCING_KEY, coalescing);
+		shell.setSize(400, 800);
+		shell.open();
+		while (display.readAndDispatch()) {
+		}
+
+		TransferData[] dataTypes = TextTransfer.getInstance().getSupportedTypes();
+		int height = tree.getClientArea().height;
+		long[] before = (long[]) getStatistics.invoke(target);
+		int time = 0, motions = 0;
+		long nanoTime = System.nanoTime();
+		for (int sweep = 0; sweep < SWEEPS; sweep++) {
+			int keyOperation = -1;
+			for (int y = 0; y < height; y++) {
+				Object event = newEvent.newInstance();
+				time += MOTION_INTERVAL;
+				setEventData.invoke(target, 50, y, time, DND.DROP_MOVE | DND.DROP_COPY, DND.DROP_DEFAULT, dataTypes.clone(), event, true);
+				dragMotion.invoke(target, event, 50, y, keyOperation);
+				keyOperation = DND.DROP_DEFAULT;
+				motions++;
+			}
+			dragLeave.invoke(target, 0L, 0L, time);
+		}
+		long nanos = System.nanoTime() - nanoTime;
+		long[] after = (long[]) getStatistics.invoke(target);
+		System.out.println("Items: " + String.format("%,8d", items)
+				+ "  coalescing: " + String.format("%3d", coalescing) + " ms"
+				+ "  moving: " + String.format("%,10d", nanos / motions) + " ns per motion"
+				+ "  drag over events: " + String.format("%,8d", after[1] - before[1])
+				+ "  coalesced: " + String.format("%,8d", after[2] - before[2])
+				+ "  hit tests: " + String.format("%,8d", after[3] - before[3])
+				+ "  cached: " + String.format("%,8d", after[4] - before[4]));
+		shell.dispose();
+	}
+}
@@ -0,0 +1,80 @@
+/*******************************************************************************
+ * Copyright (c) 2026 IBM Corporation and others.
+ *
+ * This program and the accompanying materials
+ * are made available under the terms of the Eclipse Public License 2.0
+ * which accompanies this distribution, and is available at
+ * https://www.eclipse.org/legal/epl-2.0/
+ *
+ * SPDX-License-Identifier: EPL-2.0
+ *
+ * Contributors:
+ *     IBM Corporation - initial API and implementation
+ *******************************************************************************/
+package org.eclipse.swt.tests.junit.performance;
+
+import org.eclipse.swt.SWT;
+import org.eclipse.swt.widgets.Display;
+import org.eclipse.swt.widgets.Event;
+import org.eclipse.swt.widgets.Listener;
+import org.eclipse.swt.widgets.Shell;
+
+/**
+ * Tests event dispatch performance for widgets with many listeners, most of
+ * which are registered for other event types than the one being sent.
+ */
+public class BenchmarkEventTable {
+	private static final int EVENTS = 1_000_000;
+	private static final int[] LISTENER_COUNTS = { 1, 2, 5, 10, 20, 50, 100 };
+	private static final int[] OTHER_TYPES = { SWT.Paint, SWT.KeyDown, SWT.KeyUp, SWT.MouseDown, SWT.MouseUp,
+			SWT.FocusIn, SWT.FocusOut, SWT.Resize, SWT.Move };
+	static int counter;
+
+	/**
+	 * manual performance test
+	 *
+	 * @param args ignored
+	 */
+	public static void main(String[] args) {
+		final Display display = new Display();
+		try {
+			Listener listener = e -> counter++;
+			for (int runs = 0; runs < 10; runs++) {
+				for (int count : LISTENER_COUNTS) {
+					Shell shell = new Shell(display);
+					/* One in ten listeners handles the dispatched type */
+					for (int i = 0; i < count; i++) {
+						int type = i % 10 == 0 ? SWT.MouseMove : OTHER_TYPES[i % OTHER_TYPES.length];
+						shell.addListener(type, listener);
+					}
+					Event event = new Event();
+					long nanoTime = System.nanoTime();
+					for (int i = 0; i < EVENTS; i++) {
+						shell.notifyListeners(SWT.MouseMove, event);
+					}
+					long dispatchNanos = System.nanoTime() - nanoTime;
+
+					nanoTime = System.nanoTime();
+					for (int i = 0; i < EVENTS; i++) {
+						shell.isListening(SWT.MouseMove);
+					}
+					long hooksNanos = System.nanoTime() - nanoTime;
+
+					nanoTime = System.nanoTime();
+					for (int i = 0; i < EVENTS; i++) {
+						shell.getListeners(SWT.MouseMove);
+					}
+					long getListenersNanos = System.nanoTime() - nanoTime;
+
+					System.out.println("Listeners: " + String.format("%3d", count)
+							+ "  dispatch: " + String.format("%,15d", dispatchNanos)
+							+ " ns  isListening: " + String.format("%,15d", hooksNanos)
+							+ " ns  getListeners: " + String.format("%,15d", getListenersNanos) + " ns");
+					shell.dispose();
+				}
+			}
+		} finally {
+			display.dispose();
+		}
+	}
+}
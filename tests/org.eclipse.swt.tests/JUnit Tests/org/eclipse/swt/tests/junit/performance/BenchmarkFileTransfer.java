@@ -0,0 +1,67 @@
+/*******************************************************************************
+ * Copyright (c) 2026 IBM Corporation and others.
+ *
+ * This program and the accompanying materials
+ * are made available under the terms of the Eclipse Public License 2.0
+ * which accompanies this distribution, and is available at
+ * https://www.eclipse.org/legal/epl-2.0/
+ *
+ * SPDX-License-Identifier: EPL-2.0
+ *
+ * Contributors:
+ *     IBM Corporation - initial API and implementation
+ *******************************************************************************/
+package org.eclipse.swt.tests.junit.performance;
+
+import org.eclipse.swt.dnd.Clipboard;
+import org.eclipse.swt.dnd.FileTransfer;
+import org.eclipse.swt.dnd.Transfer;
+import org.eclipse.swt.widgets.Display;
+
+/**
+ * Tests copying a large selection of files to the clipboard and pasting it
+ * back, which converts the file names to a URI list and the URI list back
+ * to file names.
+ */
+public class BenchmarkFileTransfer {
+	private static final int[] FILE_COUNTS = { 1_000, 10_000, 100_000 };
+
+	/**
+	 * manual performance test
+	 *
+	 * @param args ignored
+	 */
+	public static void main(String[] args) {
+		final Display display = new Display();
+		Clipboard clipboard = new Clipboard(display);
+		try {
+			for (int runs = 0; runs < 5; runs++) {
+				for (int files : FILE_COUNTS) {
+					measure(clipboard, files);
+				}
+			}
+		} finally {
+			clipboard.dispose();
+			display.dispose();
+		}
+	}
+
+	static void measure(Clipboard clipboard, int files) {
+		String[] paths = new String[files];
+		for (int i = 0; i < files; i++) {
+			paths[i] = "/tmp/benchmark/folder " + (i / 100) + "/fileé" + i + ".txt";
+		}
+		long nanoTime = System.nanoTime();
+		clipboard.setContents(new Object[] { paths }, new Transfer[] { FileTransfer.getInstance() });
+		long copyNanos = System.nanoTime() - nanoTime;
+		nanoTime = System.nanoTime();
+		String[] result = (String[]) clipboard.getContents(FileTransfer.getInstance());
+		long pasteNanos = System.nanoTime() - nanoTime;
+		if (result == null || result.length != files) {
+			throw new IllegalStateException("Pasted " + (result == null ? 0 : result.length) + " of " + files + " files");
+		}
+		System.out.println("Files: " + String.format("%,8d", files)
+				+ "  copying: " + String.format("%,15d", copyNanos) + " ns"
+				+ "  pasting: " + String.format("%,15d", pasteNanos) + " ns");
+	}
+}
@@ -0,0 +1,115 @@
+/*******************************************************************************
+ * Copyright (c) 2026 IBM Corporation and others.
+ *
+ * This program and the accompanying materials
+ * are made available under the terms of the Eclipse Public License 2.0
+ * which accompanies this distribution, and is available at
+ * https://www.eclipse.org/legal/epl-2.0/
+ *
+ * SPDX-License-Identifier: EPL-2.0
+ *
+ * Contributors:
+ *     IBM Corporation - initial API and implementation
+ *******************************************************************************/
+package org.eclipse.swt.tests.junit.performance;
+
+import java.lang.reflect.Method;
+import java.util.Random;
+
+import org.eclipse.swt.SWT;
+import org.eclipse.swt.widgets.Display;
+import org.eclipse.swt.widgets.Shell;
+import org.eclipse.swt.widgets.Table;
+import org.eclipse.swt.widgets.TableItem;
+import org.eclipse.swt.widgets.Tree;
+import org.eclipse.swt.widgets.TreeItem;
+
+/**
+ * Tests indexOf() on items picked at random from a large table and from
+ * the children of one item of a tree, as done by code that maps the items
+ * of a selection or of events back to model indices. Optionally an item is
+ * inserted at the top every few hundred lookups, which shifts the indices
+ * of all other items. On GTK the number of scans that renumbered the items
+ * is reported too.
+ */
+public class BenchmarkItemIndexOf {
+	private static final int[] ITEM_COUNTS = { 10_000, 100_000 };
+	private static final int LOOKUPS = 100_000;
+	private static final int INSERT_INTERVAL = 500;
+
+	/**
+	 * manual performance test
+	 *
+	 * @param args ignored
+	 */
+	public static void main(String[] args) throws ReflectiveOperationException {
+		final Display display = new Display();
+		try {
+			for (int runs = 0; runs < 3; runs++) {
+				for (int items : ITEM_COUNTS) {
+					measureTable(display, items, false);
+					measureTable(display, items, true);
+					measureTree(display, items, false);
+					measureTree(display, items, true);
+				}
+			}
+		} finally {
+			display.dispose();
+		}
+	}
+
+	static void measureTable(Display display, int count, boolean insert) throws ReflectiveOperationException {
+		Shell shell = new Shell(display);
+		Table table = new Table(shell, SWT.MULTI);
+		TableItem[] items = new TableItem[count];
+		for (int i = 0; i < count; i++) {
+			items[i] = new TableItem(table, SWT.NONE);
+		}
+		Random random = new Random(count);
+		long scans = scanCount(table);
+		long nanoTime = System.nanoTime();
+		for (int i = 0; i < LOOKUPS; i++) {
+			if (insert && i % INSERT_INTERVAL == 0) new TableItem(table, SWT.NONE, 0);
+			table.indexOf(items[random.nextInt(count)]);
+		}
+		long nanos = System.nanoTime() - nanoTime;
+		report("Table", count, insert, nanos, scanCount(table) - scans);
+		shell.dispose();
+	}
+
+	static void measureTree(Display display, int count, boolean insert) throws ReflectiveOperationException {
+		Shell shell = new Shell(display);
+		Tree tree = new Tree(shell, SWT.MULTI);
+		TreeItem root = new TreeItem(tree, SWT.NONE);
+		TreeItem[] items = new TreeItem[count];
+		for (int i = 0; i < count; i++) {
+			items[i] = new TreeItem(root, SWT.NONE);
+		}
+		Random random = new Random(count);
+		long scans = scanCount(tree);
+		long nanoTime = System.nanoTime();
+		for (int i = 0; i < LOOKUPS; i++) {
+			if (insert && i % INSERT_INTERVAL == 0) new TreeItem(root, SWT.NONE, 0);
+			root.indexOf(items[random.nextInt(count)]);
+		}
+		long nanos = System.nanoTime() - nanoTime;
+		report("Tree", count, insert, nanos, scanCount(tree) - scans);
+		shell.dispose();
+	}
+
+	static long scanCount(Object control) throws ReflectiveOperationException {
+		if (!"gtk".equals(SWT.getPlatform())) return 0;
+		Method method = control.getClass().getDeclaredMethod("getIndexStatistics");
+		method.setAccessible(true);
+		Object statistics = method.invoke(control);
+		return statistics instanceof long[] ? ((long[]) statistics)[0] : (Long) statistics;
+	}
+
+	static void report(String name, int count, boolean insert, long nanos, long scans) {
+		System.out.println(String.format("%-6s", name)
+				+ "  items: " + String.format("%,8d", count)
+				+ "  inserting: " + (insert ? "yes" : "no ")
+				+ "  indexOf: " + String.format("%,15d", nanos / LOOKUPS) + " ns"
+				+ "  scans: " + String.format("%,8d", scans));
+	}
+}
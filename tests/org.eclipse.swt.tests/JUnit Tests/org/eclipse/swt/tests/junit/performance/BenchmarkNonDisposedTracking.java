@@ -0,0 +1,92 @@
+/*******************************************************************************
+ * Copyright (c) 2026 IBM Corporation and others.
+ *
+ * This program and the accompanying materials
+ * are made available under the terms of the Eclipse Public License 2.0
+ * which accompanies this distribution, and is available at
+ * https://www.eclipse.org/legal/epl-2.0/
+ *
+ * SPDX-License-Identifier: EPL-2.0
+ *
+ * Contributors:
+ *     IBM Corporation - initial API and implementation
+ *******************************************************************************/
+package org.eclipse.swt.tests.junit.performance;
+
+import org.eclipse.swt.SWT;
+import org.eclipse.swt.graphics.Color;
+import org.eclipse.swt.graphics.Font;
+import org.eclipse.swt.graphics.Image;
+import org.eclipse.swt.graphics.Resource;
+import org.eclipse.swt.widgets.Display;
+
+/**
+ * Tests Color, Font and Image creation throughput with detection of non
+ * disposed resources disabled, sampled, limited by a per type budget and
+ * tracking every resource.
+ */
+public class BenchmarkNonDisposedTracking {
+	private static final int RESOURCES = 20_000;
+	static int reported;
+
+	/**
+	 * manual performance test
+	 *
+	 * @param args ignored
+	 */
+	public static void main(String[] args) {
+		final Display display = new Display();
+		try {
+			for (int runs = 0; runs < 10; runs++) {
+				measure(display, "disabled", false, 1, 0);
+				measure(display, "1 in 100", true, 100, 0);
+				measure(display, "budget 100", true, 1, 100);
+				measure(display, "full", true, 1, 0);
+			}
+			System.out.println("Reported leaks: " + reported + "  " + Resource.getNonDisposedCounts());
+		} finally {
+			Resource.setNonDisposeHandler(null);
+			display.dispose();
+		}
+	}
+
+	static void measure(Display display, String mode, boolean tracking, int sampleRate, int typeBudget) {
+		Resource.setNonDisposeHandler(tracking ? error -> reported++ : null);
+		Resource.setNonDisposeSampling(sampleRate, typeBudget);
+		Color[] colors = new Color[RESOURCES];
+		Font[] fonts = new Font[RESOURCES];
+		Image[] images = new Image[RESOURCES];
+
+		long nanoTime = System.nanoTime();
+		for (int i = 0; i < RESOURCES; i++) {
+			colors[i] = new Color(display, i & 0xFF, (i >> 8) & 0xFF, 0);
+		}
+		long colorNanos = System.nanoTime() - nanoTime;
+
+		nanoTime = System.nanoTime();
+		for (int i = 0; i < RESOURCES; i++) {
+			fonts[i] = new Font(display, "Sans", 8 + (i & 7), SWT.NORMAL);
+		}
+		long fontNanos = System.nanoTime() - nanoTime;
+
+		nanoTime = System.nanoTime();
+		for (int i = 0; i < RESOURCES; i++) {
+			images[i] = new Image(display, 4, 4);
+		}
+		long imageNanos = System.nanoTime() - nanoTime;
+
+		nanoTime = System.nanoTime();
+		for (int i = 0; i < RESOURCES; i++) {
+			colors[i].dispose();
+			fonts[i].dispose();
+			images[i].dispose();
+		}
+		long disposeNanos = System.nanoTime() - nanoTime;
+
+		System.out.println("Tracking: " + String.format("%-12s", mode)
+				+ "  Color: " + String.format("%,15d", colorNanos)
+				+ " ns  Font: " + String.format("%,15d", fontNanos)
+				+ " ns  Image: " + String.format("%,15d", imageNanos)
+				+ " ns  dispose: " + String.format("%,15d", disposeNanos) + " ns");
+	}
+}
@@ -0,0 +1,98 @@
+/*******************************************************************************
+ * Copyright (c) 2026 IBM Corporation and others.
+ *
+ * This program and the accompanying materials
+ * are made available under the terms of the Eclipse Public License 2.0
+ * which accompanies this distribution, and is available at
+ * https://www.eclipse.org/legal/epl-2.0/
+ *
+ * SPDX-License-Identifier: EPL-2.0
+ *
+ * Contributors:
+ *     IBM Corporation - initial API and implementation
+ *******************************************************************************/
+package org.eclipse.swt.tests.junit.performance;
+
+import org.eclipse.swt.SWT;
+import org.eclipse.swt.layout.FillLayout;
+import org.eclipse.swt.widgets.Canvas;
+import org.eclipse.swt.widgets.Display;
+import org.eclipse.swt.widgets.Shell;
+
+/**
+ * Tests a canvas that invalidates thousands of small cells per update, with
+ * redraw coalescing enabled and disabled. On GTK, the counters of requested,
+ * coalesced and flushed invalidations are printed as well.
+ */
+public class BenchmarkRedrawCoalescing {
+	private static final int COLUMNS = 100;
+	private static final int ROWS = 100;
+	private static final int CELL = 8;
+	private static final int UPDATES = 50;
+	private static final String COALESCING_KEY = "org.eclipse.swt.internal.gtk.redrawCoalescing";
+	private static final String STATISTICS_KEY = "org.eclipse.swt.internal.gtk.redrawStatistics";
+	static int paints;
+
+	/**
+	 * manual performance test
+	 *
+	 * @param args ignored
+	 */
+	public static void main(String[] args) {
+		final Display display = new Display();
+		try {
+			Shell shell = new Shell(display);
+			shell.setLayout(new FillLayout());
+			Canvas canvas = new Canvas(shell, SWT.NO_BACKGROUND);
+			canvas.addPaintListener(e -> paints++);
+			shell.setSize(COLUMNS * CELL + 50, ROWS * CELL + 50);
+			shell.open();
+			dispatch(display);
+			for (int runs = 0; runs < 10; runs++) {
+				measure(display, canvas, true);
+				measure(display, canvas, false);
+			}
+		} finally {
+			display.dispose();
+		}
+	}
+
+	static void measure(Display display, Canvas canvas, boolean coalescing) {
+		display.setData(COALESCING_KEY, Boolean.valueOf(coalescing));
+		display.setData(STATISTICS_KEY, null);
+		int startPaints = paints;
+		long redrawNanos = 0;
+		long nanoTime = System.nanoTime();
+		for (int update = 0; update < UPDATES; update++) {
+			long redrawStart = System.nanoTime();
+			for (int row = 0; row < ROWS; row++) {
+				for (int column = (row + update) % 2; column < COLUMNS; column += 2) {
+					canvas.redraw(column * CELL, row * CELL, CELL, CELL, false);
+				}
+			}
+			redrawNanos += System.nanoTime() - redrawStart;
+			dispatch(display);
+		}
+		long totalNanos = System.nanoTime() - nanoTime;
+
+		String statistics = "n/a";
+		Object data = display.getData(STATISTICS_KEY);
+		if (data instanceof long[]) {
+			long[] counters = (long[]) data;
+			statistics = String.format("requested %,d coalesced %,d regions %,d frames %,d", counters[0], counters[1],
+					counters[2], counters[3]);
+		}
+		System.out.println("Coalescing: " + String.format("%-5s", coalescing)
+				+ "  redraw calls: " + String.format("%,15d", redrawNanos)
+				+ " ns  total: " + String.format("%,15d", totalNanos)
+				+ " ns  paints: " + String.format("%,6d", paints - startPaints)
+				+ "  " + statistics);
+	}
+
+	static void dispatch(Display display) {
+		while (display.readAndDispatch()) {
+			// dispatch
+		}
+		display.update();
+	}
+}
@@ -0,0 +1,80 @@
+/*******************************************************************************
+ * Copyright (c) 2026 IBM Corporation and others.
+ *
+ * This program and the accompanying materials
+ * are made available under the terms of the Eclipse Public License 2.0
+ * which accompanies this distribution, and is available at
+ * https://www.eclipse.org/legal/epl-2.0/
+ *
+ * SPDX-License-Identifier: EPL-2.0
+ *
+ * Contributors:
+ *     IBM Corporation - initial API and implementation
+ *******************************************************************************/
+package org.eclipse.swt.tests.junit.performance;
+
+import org.eclipse.swt.graphics.Color;
+import org.eclipse.swt.graphics.DeviceData;
+import org.eclipse.swt.graphics.Region;
+import org.eclipse.swt.widgets.Display;
+
+/**
+ * Tests resource allocation throughput with device tracking disabled, with
+ * sampled allocation stacks and with a stack captured for every allocation.
+ */
+public class BenchmarkResourceTracking {
+	private static final int LIVE_RESOURCES = 20_000;
+	private static final String SAMPLE_RATE = "org.eclipse.swt.internal.tracking.sampleRate";
+	private static final String STACK_DEPTH = "org.eclipse.swt.internal.tracking.stackDepth";
+
+	/**
+	 * manual performance test
+	 *
+	 * @param args ignored
+	 */
+	public static void main(String[] args) {
+		final Display display = new Display();
+		try {
+			for (int runs = 0; runs < 10; runs++) {
+				measure(display, "off", false, "1", "0");
+				measure(display, "full", true, "1", "0");
+				measure(display, "depth 8", true, "1", "8");
+				measure(display, "1 in 100", true, "100", "0");
+				measure(display, "1 in 100, depth 8", true, "100", "8");
+			}
+		} finally {
+			display.dispose();
+		}
+	}
+
+	static void measure(Display display, String mode, boolean tracking, String sampleRate, String stackDepth) {
+		System.setProperty(SAMPLE_RATE, sampleRate);
+		System.setProperty(STACK_DEPTH, stackDepth);
+		display.setTracking(tracking);
+		Region[] regions = new Region[LIVE_RESOURCES];
+		Color[] colors = new Color[LIVE_RESOURCES];
+
+		long nanoTime = System.nanoTime();
+		for (int i = 0; i < LIVE_RESOURCES; i++) {
+			regions[i] = new Region(display);
+			colors[i] = new Color(display, i & 0xFF, (i >> 8) & 0xFF, 0);
+		}
+		long allocateNanos = System.nanoTime() - nanoTime;
+
+		DeviceData data = display.getDeviceData();
+		int sites = data.allocationSites != null ? data.allocationSites.length : 0;
+
+		nanoTime = System.nanoTime();
+		for (int i = 0; i < LIVE_RESOURCES; i++) {
+			regions[i].dispose();
+		}
+		long disposeNanos = System.nanoTime() - nanoTime;
+		display.setTracking(false);
+
+		System.out.println("Tracking: " + String.format("%-18s", mode)
+				+ "  allocating: " + String.format("%,15d", allocateNanos)
+				+ " ns  disposing: " + String.format("%,15d", disposeNanos)
+				+ " ns  live objects: " + String.format("%,8d", data.objects.length)
+				+ "  sites: " + sites);
+	}
+}
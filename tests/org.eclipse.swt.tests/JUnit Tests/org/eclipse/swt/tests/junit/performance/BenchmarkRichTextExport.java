@@ -0,0 +1,104 @@
+/*******************************************************************************
+ * Copyright (c) 2026 IBM Corporation and others.
+ *
+ * This program and the accompanying materials
+ * are made available under the terms of the Eclipse Public License 2.0
+ * which accompanies this distribution, and is available at
+ * https://www.eclipse.org/legal/epl-2.0/
+ *
+ * SPDX-License-Identifier: EPL-2.0
+ *
+ * Contributors:
+ *     IBM Corporation - initial API and implementation
+ *******************************************************************************/
+package org.eclipse.swt.tests.junit.performance;
+
+import java.io.IOException;
+import java.io.Writer;
+
+import org.eclipse.swt.SWT;
+import org.eclipse.swt.custom.StyleRange;
+import org.eclipse.swt.custom.StyledText;
+import org.eclipse.swt.graphics.Color;
+import org.eclipse.swt.widgets.Display;
+import org.eclipse.swt.widgets.Shell;
+
+/**
+ * Tests streaming RTF and HTML export of large documents in which every
+ * word is styled, using a few distinct styles. The output is discarded,
+ * so the throughput and the peak heap reflect the export alone.
+ */
+public class BenchmarkRichTextExport {
+	private static final int[] LINE_COUNTS = { 10_000, 100_000, 500_000 };
+	private static final String[] WORDS = { "alpha", "beta", "gamma", "delta", "epsilon", "zeta", "eta", "theta" };
+
+	/**
+	 * manual performance test
+	 *
+	 * @param args ignored
+	 * @throws IOException never, the output is discarded
+	 */
+	public static void main(String[] args) throws IOException {
+		final Display display = new Display();
+		try {
+			Shell shell = new Shell(display);
+			StyledText text = new StyledText(shell, SWT.MULTI);
+			for (int runs = 0; runs < 5; runs++) {
+				for (int lines : LINE_COUNTS) {
+					fill(text, lines);
+					measure(text, lines, "RTF", true);
+					measure(text, lines, "HTML", false);
+				}
+			}
+		} finally {
+			display.dispose();
+		}
+	}
+
+	static void measure(StyledText text, int lines, String format, boolean rtf) throws IOException {
+		Runtime runtime = Runtime.getRuntime();
+		System.gc();
+		long usedBefore = runtime.totalMemory() - runtime.freeMemory();
+		Writer output = Writer.nullWriter();
+		long nanoTime = System.nanoTime();
+		long chars = rtf ? text.writeRTF(output, 0, text.getCharCount()) : text.writeHTML(output, 0, text.getCharCount());
+		long nanos = System.nanoTime() - nanoTime;
+		long usedAfter = runtime.totalMemory() - runtime.freeMemory();
+		double charsPerSecond = chars * 1e9 / nanos;
+		System.out.println("Lines: " + String.format("%,8d", lines)
+				+ "  " + String.format("%-4s", format)
+				+ "  time: " + String.format("%,15d", nanos)
+				+ " ns  output: " + String.format("%,13d", chars)
+				+ " chars  throughput: " + String.format("%,8.1f", charsPerSecond / 1e6)
+				+ " Mchars/s  heap growth: " + String.format("%,6d", (usedAfter - usedBefore) >> 20) + " MB");
+	}
+
+	static void fill(StyledText text, int lines) {
+		Display display = text.getDisplay();
+		Color[] colors = { display.getSystemColor(SWT.COLOR_DARK_RED), display.getSystemColor(SWT.COLOR_DARK_BLUE),
+				display.getSystemColor(SWT.COLOR_DARK_GREEN) };
+		StyleRange[] distinct = new StyleRange[6];
+		for (int i = 0; i < distinct.length; i++) {
+			distinct[i] = new StyleRange();
+			distinct[i].foreground = colors[i % colors.length];
+			distinct[i].fontStyle = i < 3 ? SWT.BOLD : SWT.ITALIC;
+			distinct[i].underline = i == 5;
+		}
+		StringBuilder buffer = new StringBuilder();
+		int[] ranges = new int[lines * WORDS.length * 2];
+		StyleRange[] styles = new StyleRange[lines * WORDS.length];
+		int count = 0;
+		for (int i = 0; i < lines; i++) {
+			for (String word : WORDS) {
+				ranges[count * 2] = buffer.length();
+				ranges[count * 2 + 1] = word.length();
+				styles[count] = distinct[count % distinct.length];
+				count++;
+				buffer.append(word).append(" <&> ");
+			}
+			buffer.append('\n');
+		}
+		text.setText(buffer.toString());
+		text.setStyleRanges(ranges, styles);
+	}
+}
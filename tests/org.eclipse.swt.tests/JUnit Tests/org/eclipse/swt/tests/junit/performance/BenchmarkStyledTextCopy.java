@@ -0,0 +1,106 @@
+/*******************************************************************************
+ * Copyright (c) 2026 IBM Corporation and others.
+ *
+ * This program and the accompanying materials
+ * are made available under the terms of the Eclipse Public License 2.0
+ * which accompanies this distribution, and is available at
+ * https://www.eclipse.org/legal/epl-2.0/
+ *
+ * SPDX-License-Identifier: EPL-2.0
+ *
+ * Contributors:
+ *     IBM Corporation - initial API and implementation
+ *******************************************************************************/
+package org.eclipse.swt.tests.junit.performance;
+
+import org.eclipse.swt.SWT;
+import org.eclipse.swt.custom.StyleRange;
+import org.eclipse.swt.custom.StyledText;
+import org.eclipse.swt.dnd.Clipboard;
+import org.eclipse.swt.dnd.HTMLTransfer;
+import org.eclipse.swt.dnd.RTFTransfer;
+import org.eclipse.swt.dnd.TextTransfer;
+import org.eclipse.swt.dnd.Transfer;
+import org.eclipse.swt.widgets.Display;
+import org.eclipse.swt.widgets.Shell;
+
+/**
+ * Tests copying large styled selections from a StyledText. The copy itself
+ * only takes a snapshot of the selection; each clipboard format is written
+ * when it is first requested, which is timed separately.
+ */
+public class BenchmarkStyledTextCopy {
+	private static final int[] LINE_COUNTS = { 10_000, 100_000, 1_000_000 };
+	private static final String LINE = "The quick brown fox jumps over the lazy dog 0123456789";
+
+	/**
+	 * manual performance test
+	 *
+	 * @param args ignored
+	 */
+	public static void main(String[] args) {
+		final Display display = new Display();
+		try {
+			Shell shell = new Shell(display);
+			StyledText text = new StyledText(shell, SWT.MULTI);
+			Clipboard clipboard = new Clipboard(display);
+			for (int runs = 0; runs < 5; runs++) {
+				for (int lines : LINE_COUNTS) {
+					fill(text, lines);
+					text.selectAll();
+
+					long nanoTime = System.nanoTime();
+					text.copy();
+					long copyNanos = System.nanoTime() - nanoTime;
+
+					long textNanos = request(display, clipboard, TextTransfer.getInstance());
+					long rtfNanos = request(display, clipboard, RTFTransfer.getInstance());
+					long htmlNanos = request(display, clipboard, HTMLTransfer.getInstance());
+
+					System.out.println("Lines: " + String.format("%,10d", lines)
+							+ "  copy: " + String.format("%,15d", copyNanos)
+							+ " ns  text: " + String.format("%,15d", textNanos)
+							+ " ns  RTF: " + String.format("%,15d", rtfNanos)
+							+ " ns  HTML: " + String.format("%,15d", htmlNanos) + " ns");
+				}
+			}
+			clipboard.dispose();
+		} finally {
+			display.dispose();
+		}
+	}
+
+	static void fill(StyledText text, int lines) {
+		StringBuilder buffer = new StringBuilder(lines * (LINE.length() + 1));
+		for (int i = 0; i < lines; i++) {
+			buffer.append(LINE).append('\n');
+		}
+		text.setText(buffer.toString());
+		/* Style every tenth line, alternating bold and colored ranges */
+		int lineLength = LINE.length() + 1;
+		StyleRange[] styles = new StyleRange[lines / 10];
+		for (int i = 0; i < styles.length; i++) {
+			StyleRange style = new StyleRange(i * 10 * lineLength + 4, 15, null, null);
+			if (i % 2 == 0) {
+				style.fontStyle = SWT.BOLD;
+			} else {
+				style.foreground = text.getDisplay().getSystemColor(SWT.COLOR_DARK_RED);
+			}
+			styles[i] = style;
+		}
+		text.setStyleRanges(styles);
+	}
+
+	static long request(Display display, Clipboard clipboard, Transfer transfer) {
+		long nanoTime = System.nanoTime();
+		Object contents = clipboard.getContents(transfer);
+		long nanos = System.nanoTime() - nanoTime;
+		if (contents == null) {
+			System.out.println("No contents for " + transfer.getClass().getSimpleName());
+		}
+		while (display.readAndDispatch()) {
+			// dispatch
+		}
+		return nanos;
+	}
+}
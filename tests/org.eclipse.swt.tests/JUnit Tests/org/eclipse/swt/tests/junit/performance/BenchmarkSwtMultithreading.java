@@ -13,6 +13,8 @@
  *******************************************************************************/
 package org.eclipse.swt.tests.junit.performance;
 
+import java.util.Arrays;
+import java.util.concurrent.CountDownLatch;
 import java.util.concurrent.atomic.AtomicInteger;
 import java.util.concurrent.atomic.AtomicLong;
 
@@ -23,16 +25,23 @@ import org.eclipse.swt.widgets.Display;
  */
 public class BenchmarkSwtMultithreading {
 	private static final int BATCH_SIZE = 1_000_000;
+	private static final int SYNC_CALLS_PER_RUN = 200_000;
+	private static final int[] PRODUCER_THREADS = { 1, 2, 4, 8, 16, 32, 64 };
 	static AtomicInteger countdown = new AtomicInteger();
 
 	/**
 	 * manual performance test
 	 * see https://github.com/eclipse-platform/eclipse.platform.swt/issues/74
 	 *
-	 * @param args ignored
+	 * @param args "syncExec" to measure syncExec throughput and latency with
+	 *             1 to 64 producer threads, otherwise asyncExec is measured
 	 * @throws InterruptedException
 	 */
 	public static void main(String[] args) throws InterruptedException {
+		if (args.length > 0 && "syncExec".equals(args[0])) {
+			benchmarkSyncExec();
+			return;
+		}
 		final Display display = new Display();
 		try {
 			for (int runs = 0; runs < 100; runs++) {
@@ -78,4 +87,66 @@ public class BenchmarkSwtMultithreading {
 		long durationNanos = nanoTime2 - nanoTime;
 		return durationNanos;
 	}
+
+	/**
+	 * Measures syncExec throughput and tail latency while an increasing number
+	 * of producer threads compete for the user-interface thread.
+	 */
+	static void benchmarkSyncExec() throws InterruptedException {
+		final Display display = new Display();
+		try {
+			for (int runs = 0; runs < 5; runs++) {
+				for (int producers : PRODUCER_THREADS) {
+					int callsPerThread = SYNC_CALLS_PER_RUN / producers;
+					long[][] latencies = new long[producers][callsPerThread];
+					CountDownLatch done = new CountDownLatch(producers);
+					Thread[] threads = new Thread[producers];
+					for (int t = 0; t < producers; t++) {
+						long[] threadLatencies = latencies[t];
+						threads[t] = new Thread(() -> {
+							try {
+								for (int i = 0; i < callsPerThread; i++) {
+									long start = System.nanoTime();
+									display.syncExec(Display::getCurrent);
+									threadLatencies[i] = System.nanoTime() - start;
+								}
+							} finally {
+								done.countDown();
+								display.wake();
+							}
+						}, "producer-" + t);
+					}
+
+					long nanoTime = System.nanoTime();
+					for (Thread thread : threads) {
+						thread.start();
+					}
+					while (done.getCount() > 0) {
+						if (!display.readAndDispatch())
+							display.sleep();
+					}
+					long durationNanos = System.nanoTime() - nanoTime;
+					for (Thread thread : threads) {
+						thread.join();
+					}
+
+					long[] all = Arrays.stream(latencies).flatMapToLong(Arrays::stream).sorted().toArray();
+					long throughput = all.length * 1_000_000_000L / Math.max(1, durationNanos);
+					System.out.println("Producers: " + String.format("%3d", producers)
+							+ "  throughput: " + String.format("%,12d", throughput) + " calls/s"
+							+ "  p50: " + String.format("%,10d", percentile(all, 0.50)) + " ns"
+							+ "  p99: " + String.format("%,10d", percentile(all, 0.99)) + " ns"
+							+ "  p99.9: " + String.format("%,10d", percentile(all, 0.999)) + " ns"
+							+ "  max: " + String.format("%,12d", all[all.length - 1]) + " ns");
+				}
+			}
+		} finally {
+			display.dispose();
+		}
+	}
+
+	private static long percentile(long[] sorted, double p) {
+		int index = (int) Math.min(sorted.length - 1, Math.ceil(p * sorted.length) - 1);
+		return sorted[Math.max(0, index)];
+	}
 }
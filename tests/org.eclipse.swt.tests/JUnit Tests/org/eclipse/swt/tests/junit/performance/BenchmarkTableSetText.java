@@ -0,0 +1,91 @@
+/*******************************************************************************
+ * Copyright (c) 2026 IBM Corporation and others.
+ *
+ * This program and the accompanying materials
+ * are made available under the terms of the Eclipse Public License 2.0
+ * which accompanies this distribution, and is available at
+ * https://www.eclipse.org/legal/epl-2.0/
+ *
+ * SPDX-License-Identifier: EPL-2.0
+ *
+ * Contributors:
+ *     IBM Corporation - initial API and implementation
+ *******************************************************************************/
+package org.eclipse.swt.tests.junit.performance;
+
+import org.eclipse.swt.SWT;
+import org.eclipse.swt.layout.FillLayout;
+import org.eclipse.swt.widgets.Display;
+import org.eclipse.swt.widgets.Shell;
+import org.eclipse.swt.widgets.Table;
+import org.eclipse.swt.widgets.TableColumn;
+import org.eclipse.swt.widgets.TableItem;
+
+/**
+ * Tests populating a table with 50 columns, setting the texts of each row
+ * one cell at a time with TableItem.setText(int, String) and all at once
+ * with TableItem.setText(String[]).
+ */
+public class BenchmarkTableSetText {
+	private static final int[] ROW_COUNTS = { 1_000, 10_000, 100_000 };
+	private static final int COLUMNS = 50;
+
+	/**
+	 * manual performance test
+	 *
+	 * @param args ignored
+	 */
+	public static void main(String[] args) {
+		final Display display = new Display();
+		try {
+			for (int runs = 0; runs < 3; runs++) {
+				for (int rows : ROW_COUNTS) {
+					long cellNanos = populate(display, rows, false);
+					long rowNanos = populate(display, rows, true);
+					System.out.println("Rows: " + String.format("%,8d", rows)
+							+ "  per cell: " + String.format("%,15d", cellNanos / rows) + " ns per row"
+							+ "  per row: " + String.format("%,15d", rowNanos / rows) + " ns per row");
+				}
+			}
+		} finally {
+			display.dispose();
+		}
+	}
+
+	static long populate(Display display, int rows, boolean bulk) {
+		Shell shell = new Shell(display);
+		shell.setLayout(new FillLayout());
+		Table table = new Table(shell, SWT.BORDER);
+		table.setHeaderVisible(true);
+		for (int i = 0; i < COLUMNS; i++) {
+			TableColumn column = new TableColumn(table, SWT.NONE);
+			column.setText("Column " + i);
+			column.setWidth(60);
+		}
+		shell.setSize(800, 600);
+		shell.open();
+		while (display.readAndDispatch()) {
+		}
+
+		String[] texts = new String[COLUMNS];
+		long nanoTime = System.nanoTime();
+		for (int row = 0; row < rows; row++) {
+			for (int i = 0; i < COLUMNS; i++) {
+				texts[i] = "Cell " + row + "." + i;
+			}
+			TableItem item = new TableItem(table, SWT.NONE);
+			if (bulk) {
+				item.setText(texts);
+			} else {
+				for (int i = 0; i < COLUMNS; i++) {
+					item.setText(i, texts[i]);
+				}
+			}
+		}
+		while (display.readAndDispatch()) {
+		}
+		long nanos = System.nanoTime() - nanoTime;
+		shell.dispose();
+		return nanos;
+	}
+}
@@ -0,0 +1,84 @@
+/*******************************************************************************
+ * Copyright (c) 2026 IBM Corporation and others.
+ *
+ * This program and the accompanying materials
+ * are made available under the terms of the Eclipse Public License 2.0
+ * which accompanies this distribution, and is available at
+ * https://www.eclipse.org/legal/epl-2.0/
+ *
+ * SPDX-License-Identifier: EPL-2.0
+ *
+ * Contributors:
+ *     IBM Corporation - initial API and implementation
+ *******************************************************************************/
+package org.eclipse.swt.tests.junit.performance;
+
+import java.util.concurrent.atomic.AtomicInteger;
+
+import org.eclipse.swt.widgets.Display;
+
+/**
+ * Tests Display.timerExec scheduling and cancellation performance with many
+ * concurrently pending timers.
+ */
+public class BenchmarkTimerExec {
+	private static final int TIMER_COUNT = 10_000;
+	private static final String TIMER_COALESCING_KEY = "org.eclipse.swt.internal.gtk.timerCoalescing";
+	static AtomicInteger countdown = new AtomicInteger();
+
+	/**
+	 * manual performance test
+	 *
+	 * @param args optional coalescing interval in milliseconds (GTK only)
+	 */
+	public static void main(String[] args) {
+		final Display display = new Display();
+		try {
+			if (args.length > 0) {
+				display.setData(TIMER_COALESCING_KEY, Integer.valueOf(args[0]));
+			}
+			Runnable[] runnables = new Runnable[TIMER_COUNT];
+			for (int i = 0; i < TIMER_COUNT; i++) {
+				runnables[i] = () -> countdown.decrementAndGet();
+			}
+			for (int runs = 0; runs < 20; runs++) {
+				countdown.set(TIMER_COUNT);
+
+				long nanoTime = System.nanoTime();
+				for (int i = 0; i < TIMER_COUNT; i++) {
+					display.timerExec(60_000 + i, runnables[i]);
+				}
+				long scheduleNanos = System.nanoTime() - nanoTime;
+
+				nanoTime = System.nanoTime();
+				for (int i = 0; i < TIMER_COUNT; i++) {
+					display.timerExec(60_000 - i, runnables[i]);
+				}
+				long rescheduleNanos = System.nanoTime() - nanoTime;
+
+				nanoTime = System.nanoTime();
+				for (int i = 0; i < TIMER_COUNT; i++) {
+					display.timerExec(-1, runnables[i]);
+				}
+				long cancelNanos = System.nanoTime() - nanoTime;
+
+				nanoTime = System.nanoTime();
+				for (int i = 0; i < TIMER_COUNT; i++) {
+					display.timerExec(i % 100, runnables[i]);
+				}
+				while (countdown.get() > 0) {
+					if (!display.readAndDispatch())
+						display.sleep();
+				}
+				long fireNanos = System.nanoTime() - nanoTime;
+
+				System.out.println("Duration for scheduling: " + String.format("%,15d", scheduleNanos)
+						+ " ns  rescheduling: " + String.format("%,15d", rescheduleNanos)
+						+ " ns  cancelling: " + String.format("%,15d", cancelNanos)
+						+ " ns  firing: " + String.format("%,15d", fireNanos) + " ns");
+			}
+		} finally {
+			display.dispose();
+		}
+	}
+}
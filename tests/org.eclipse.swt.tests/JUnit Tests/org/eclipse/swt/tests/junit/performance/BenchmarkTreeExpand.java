@@ -0,0 +1,137 @@
+/*******************************************************************************
+ * Copyright (c) 2026 IBM Corporation and others.
+ *
+ * This program and the accompanying materials
+ * are made available under the terms of the Eclipse Public License 2.0
+ * which accompanies this distribution, and is available at
+ * https://www.eclipse.org/legal/epl-2.0/
+ *
+ * SPDX-License-Identifier: EPL-2.0
+ *
+ * Contributors:
+ *     IBM Corporation - initial API and implementation
+ *******************************************************************************/
+package org.eclipse.swt.tests.junit.performance;
+
+import org.eclipse.swt.SWT;
+import org.eclipse.swt.layout.FillLayout;
+import org.eclipse.swt.widgets.Display;
+import org.eclipse.swt.widgets.Shell;
+import org.eclipse.swt.widgets.Tree;
+import org.eclipse.swt.widgets.TreeItem;
+
+/**
+ * Tests expanding and collapsing a whole tree of about 100k nodes below one
+ * root item, once by calling setExpanded() on every item and once with a
+ * single setSubtreeExpanded() call. Virtual trees are expanded with their
+ * data requested up front. The time includes painting the expanded tree.
+ */
+public class BenchmarkTreeExpand {
+	private static final int FOLDERS = 100;
+	private static final int SUBFOLDERS = 10;
+	private static final int FILES = 100;
+
+	static int events, requests;
+
+	/**
+	 * manual performance test
+	 *
+	 * @param args ignored
+	 */
+	public static void main(String[] args) {
+		final Display display = new Display();
+		try {
+			for (int runs = 0; runs < 3; runs++) {
+				measure(display, SWT.NONE, false);
+				measure(display, SWT.NONE, true);
+				measure(display, SWT.VIRTUAL, false);
+				measure(display, SWT.VIRTUAL, true);
+			}
+		} finally {
+			display.dispose();
+		}
+	}
+
+	static void measure(Display display, int style, boolean subtree) {
+		Shell shell = new Shell(display);
+		shell.setLayout(new FillLayout());
+		Tree tree = new Tree(shell, style);
+		events = requests = 0;
+		tree.addListener(SWT.Expand, e -> events++);
+		tree.addListener(SWT.Collapse, e -> events++);
+		TreeItem root;
+		if ((style & SWT.VIRTUAL) != 0) {
+			tree.addListener(SWT.SetData, e -> {
+				TreeItem item = (TreeItem) e.item;
+				requests++;
+				item.setText("Item " + e.index);
+				TreeItem parentItem = item.getParentItem();
+				if (parentItem == null) {
+					item.setItemCount(FOLDERS);
+				} else if (parentItem.getParentItem() == null) {
+					item.setItemCount(SUBFOLDERS);
+				} else if (parentItem.getParentItem().getParentItem() == null) {
+					item.setItemCount(FILES);
+				}
+			});
+			tree.setItemCount(1);
+			root = tree.getItem(0);
+		} else {
+			root = new TreeItem(tree, SWT.NONE);
+			for (int i = 0; i < FOLDERS; i++) {
+				TreeItem folder = new TreeItem(root, SWT.NONE);
+				for (int j = 0; j < SUBFOLDERS; j++) {
+					TreeItem subfolder = new TreeItem(folder, SWT.NONE);
+					for (int k = 0; k < FILES; k++) {
+						new TreeItem(subfolder, SWT.NONE);
+					}
+				}
+			}
+		}
+		shell.setSize(400, 800);
+		shell.open();
+		while (display.readAndDispatch()) {
+		}
+
+		long nanoTime = System.nanoTime();
+		if (subtree) {
+			root.setSubtreeExpanded(true, true);
+		} else {
+			expand(root);
+		}
+		tree.update();
+		long expandNanos = System.nanoTime() - nanoTime;
+		nanoTime = System.nanoTime();
+		if (subtree) {
+			root.setSubtreeExpanded(false, false);
+		} else {
+			collapse(root);
+		}
+		tree.update();
+		long collapseNanos = System.nanoTime() - nanoTime;
+		System.out.println(((style & SWT.VIRTUAL) != 0 ? "virtual" : "regular ")
+				+ (subtree ? "  setSubtreeExpanded" : "  setExpanded       ")
+				+ "  nodes: " + String.format("%,8d", FOLDERS * SUBFOLDERS * (FILES + 1) + FOLDERS + 1)
+				+ "  expanding: " + String.format("%,15d", expandNanos) + " ns"
+				+ "  collapsing: " + String.format("%,15d", collapseNanos) + " ns"
+				+ "  events: " + String.format("%,8d", events)
+				+ "  data requests: " + String.format("%,8d", requests));
+		shell.dispose();
+	}
+
+	static void expand(TreeItem item) {
+		if (item.getItemCount() == 0) return;
+		item.setExpanded(true);
+		for (TreeItem child : item.getItems()) {
+			expand(child);
+		}
+	}
+
+	static void collapse(TreeItem item) {
+		if (item.getItemCount() == 0) return;
+		for (TreeItem child : item.getItems()) {
+			collapse(child);
+		}
+		item.setExpanded(false);
+	}
+}
@@ -0,0 +1,76 @@
+/*******************************************************************************
+ * Copyright (c) 2026 IBM Corporation and others.
+ *
+ * This program and the accompanying materials
+ * are made available under the terms of the Eclipse Public License 2.0
+ * which accompanies this distribution, and is available at
+ * https://www.eclipse.org/legal/epl-2.0/
+ *
+ * SPDX-License-Identifier: EPL-2.0
+ *
+ * Contributors:
+ *     IBM Corporation - initial API and implementation
+ *******************************************************************************/
+package org.eclipse.swt.tests.junit.performance;
+
+import org.eclipse.swt.SWT;
+import org.eclipse.swt.widgets.Display;
+import org.eclipse.swt.widgets.Shell;
+import org.eclipse.swt.widgets.Tree;
+import org.eclipse.swt.widgets.TreeItem;
+
+/**
+ * Tests enumerating the children of a tree node with a large number of
+ * children through getItems(), for a regular tree and for a virtual tree.
+ * The first call on a virtual tree creates the items, the following calls
+ * only look them up.
+ */
+public class BenchmarkTreeGetItems {
+	private static final int[] CHILD_COUNTS = { 10_000, 100_000 };
+	private static final int CALLS = 10;
+
+	/**
+	 * manual performance test
+	 *
+	 * @param args ignored
+	 */
+	public static void main(String[] args) {
+		final Display display = new Display();
+		try {
+			for (int runs = 0; runs < 3; runs++) {
+				for (int children : CHILD_COUNTS) {
+					measure(display, children, SWT.NONE, "regular");
+					measure(display, children, SWT.VIRTUAL, "virtual");
+				}
+			}
+		} finally {
+			display.dispose();
+		}
+	}
+
+	static void measure(Display display, int children, int style, String name) {
+		Shell shell = new Shell(display);
+		Tree tree = new Tree(shell, style);
+		TreeItem root = new TreeItem(tree, SWT.NONE);
+		if ((style & SWT.VIRTUAL) != 0) {
+			root.setItemCount(children);
+		} else {
+			for (int i = 0; i < children; i++) {
+				new TreeItem(root, SWT.NONE);
+			}
+		}
+		long nanoTime = System.nanoTime();
+		root.getItems();
+		long firstNanos = System.nanoTime() - nanoTime;
+		nanoTime = System.nanoTime();
+		for (int i = 0; i < CALLS; i++) {
+			root.getItems();
+		}
+		long nanos = (System.nanoTime() - nanoTime) / CALLS;
+		System.out.println(String.format("%-8s", name)
+				+ "  children: " + String.format("%,8d", children)
+				+ "  first getItems: " + String.format("%,15d", firstNanos) + " ns"
+				+ "  next getItems: " + String.format("%,15d", nanos) + " ns");
+		shell.dispose();
+	}
+}
@@ -0,0 +1,111 @@
+/*******************************************************************************
+ * Copyright (c) 2026 IBM Corporation and others.
+ *
+ * This program and the accompanying materials
+ * are made available under the terms of the Eclipse Public License 2.0
+ * which accompanies this distribution, and is available at
+ * https://www.eclipse.org/legal/epl-2.0/
+ *
+ * SPDX-License-Identifier: EPL-2.0
+ *
+ * Contributors:
+ *     IBM Corporation - initial API and implementation
+ *******************************************************************************/
+package org.eclipse.swt.tests.junit.performance;
+
+import java.lang.reflect.Field;
+
+import org.eclipse.swt.SWT;
+import org.eclipse.swt.widgets.Composite;
+import org.eclipse.swt.widgets.Display;
+import org.eclipse.swt.widgets.Label;
+import org.eclipse.swt.widgets.Shell;
+
+/**
+ * Tests creation, lookup and disposal of many widgets, which register and
+ * unregister their native handles in the widget table of the display.
+ * On GTK, the occupancy statistics of the table are printed as well.
+ */
+public class BenchmarkWidgetTable {
+	private static final int WIDGETS = 100_000;
+	private static final String STATISTICS_KEY = "org.eclipse.swt.internal.gtk.widgetTableStatistics";
+
+	/**
+	 * manual performance test
+	 *
+	 * @param args ignored
+	 * @throws ReflectiveOperationException
+	 */
+	public static void main(String[] args) throws ReflectiveOperationException {
+		final Display display = new Display();
+		Field handleField = handleField();
+		try {
+			Shell shell = new Shell(display);
+			for (int runs = 0; runs < 10; runs++) {
+				Composite composite = new Composite(shell, SWT.NONE);
+				Label[] labels = new Label[WIDGETS];
+
+				long nanoTime = System.nanoTime();
+				for (int i = 0; i < WIDGETS; i++) {
+					labels[i] = new Label(composite, SWT.NONE);
+				}
+				long createNanos = System.nanoTime() - nanoTime;
+				String full = statistics(display);
+
+				/* Look up every handle once, each lookup misses the last widget cache */
+				long lookupNanos = -1;
+				if (handleField != null) {
+					long[] handles = new long[WIDGETS];
+					for (int i = 0; i < WIDGETS; i++) {
+						handles[i] = handleField.getLong(labels[i]);
+					}
+					nanoTime = System.nanoTime();
+					for (int i = 0; i < WIDGETS; i++) {
+						display.findWidget(handles[i]);
+					}
+					lookupNanos = System.nanoTime() - nanoTime;
+				}
+
+				/* Dispose every other widget first to leave the table sparse */
+				nanoTime = System.nanoTime();
+				for (int i = 0; i < WIDGETS; i += 2) {
+					labels[i].dispose();
+				}
+				composite.dispose();
+				long disposeNanos = System.nanoTime() - nanoTime;
+
+				nanoTime = System.nanoTime();
+				display.getShells();
+				long shellsNanos = System.nanoTime() - nanoTime;
+
+				System.out.println("Widgets: " + String.format("%,d", WIDGETS)
+						+ "  creating: " + String.format("%,15d", createNanos)
+						+ " ns  looking up: " + String.format("%,12d", lookupNanos)
+						+ " ns  disposing: " + String.format("%,15d", disposeNanos)
+						+ " ns  getShells: " + String.format("%,12d", shellsNanos) + " ns"
+						+ "  full table: " + full + "  after dispose: " + statistics(display));
+			}
+			shell.dispose();
+		} finally {
+			display.dispose();
+		}
+	}
+
+	/* The native handle of a control, a public field on GTK and Windows */
+	static Field handleField() {
+		try {
+			Field field = Label.class.getField("handle");
+			return field.getType() == long.class ? field : null;
+		} catch (NoSuchFieldException e) {
+			return null;
+		}
+	}
+
+	static String statistics(Display display) {
+		Object data = display.getData(STATISTICS_KEY);
+		if (!(data instanceof int[])) return "n/a";
+		int[] statistics = (int[]) data;
+		return String.format("%,d handles in %,d slots, %,d in the upper half, grown %d, shrunk %d", statistics[0],
+				statistics[1], statistics[2], statistics[3], statistics[4]);
+	}
+}